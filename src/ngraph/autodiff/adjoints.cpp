@@ -14,6 +14,8 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <cmath>
+#include <functional>
 #include <list>
 #include <memory>
 #include <unordered_map>
@@ -22,6 +24,7 @@
 #include "ngraph/autodiff/adjoints.hpp"
 #include "ngraph/axis_set.hpp"
 #include "ngraph/function.hpp"
+#include "ngraph/graph_util.hpp"
 #include "ngraph/node.hpp"
 #include "ngraph/op/add.hpp"
 #include "ngraph/op/broadcast.hpp"
@@ -51,7 +54,169 @@ OutputVector make_zeros(std::shared_ptr<Node> x)
     return zeros;
 }
 
-autodiff::Adjoints::Adjoints(const OutputVector& ys, const OutputVector& cs)
+autodiff::CheckpointPolicy autodiff::CheckpointPolicy::every(size_t k)
+{
+    CheckpointPolicy policy;
+    policy.m_type = Type::EVERY_K;
+    policy.m_interval = std::max<size_t>(k, 1);
+    return policy;
+}
+
+autodiff::CheckpointPolicy autodiff::CheckpointPolicy::sqrt_n()
+{
+    CheckpointPolicy policy;
+    policy.m_type = Type::SQRT_N;
+    return policy;
+}
+
+autodiff::CheckpointPolicy autodiff::CheckpointPolicy::memory_budget(size_t bytes)
+{
+    CheckpointPolicy policy;
+    policy.m_type = Type::MEMORY_BUDGET;
+    policy.m_budget = bytes;
+    return policy;
+}
+
+static bool is_recomputable(const Node* node)
+{
+    return !node->is_parameter() && !node->is_constant() && !node->has_state() &&
+           node->get_output_size() > 0;
+}
+
+static size_t get_output_bytes(const Node* node)
+{
+    size_t bytes = 0;
+    for (auto output : node->outputs())
+    {
+        if (output.get_partial_shape().is_static())
+        {
+            bytes += shape_size(output.get_shape()) * output.get_element_type().size();
+        }
+    }
+    return bytes;
+}
+
+// Returns the forward nodes whose values the backward pass keeps
+static std::unordered_set<Node*> select_checkpoints(const NodeVector& forward,
+                                                    const OutputVector& ys,
+                                                    const autodiff::CheckpointPolicy& policy)
+{
+    std::unordered_set<Node*> checkpoints;
+    std::vector<Node*> candidates;
+    for (auto& node : forward)
+    {
+        if (!is_recomputable(node.get()))
+        {
+            checkpoints.insert(node.get());
+        }
+        else if (!is_type<op::GetOutputElement>(node))
+        {
+            candidates.push_back(node.get());
+        }
+    }
+    for (auto& y : ys)
+    {
+        checkpoints.insert(y.get_node());
+    }
+
+    size_t interval = policy.get_interval();
+    switch (policy.get_type())
+    {
+    case autodiff::CheckpointPolicy::Type::NONE:
+        checkpoints.insert(candidates.begin(), candidates.end());
+        break;
+    case autodiff::CheckpointPolicy::Type::SQRT_N:
+        interval = static_cast<size_t>(std::ceil(std::sqrt(candidates.size())));
+    // fall through
+    case autodiff::CheckpointPolicy::Type::EVERY_K:
+        interval = std::max<size_t>(interval, 1);
+        for (size_t i = interval - 1; i < candidates.size(); i += interval)
+        {
+            checkpoints.insert(candidates[i]);
+        }
+        break;
+    case autodiff::CheckpointPolicy::Type::MEMORY_BUDGET:
+    {
+        size_t held = 0;
+        for (Node* node : candidates)
+        {
+            size_t bytes = get_output_bytes(node);
+            if (held + bytes > policy.get_budget())
+            {
+                checkpoints.insert(node);
+                held = 0;
+            }
+            else
+            {
+                held += bytes;
+            }
+        }
+        break;
+    }
+    }
+    return checkpoints;
+}
+
+// Points every backward use of a forward value that is not a checkpoint at a copy of the
+// forward segment that produces it. The copy is control dependent on the delta that triggered
+// the backward node so it is only scheduled once backprop reaches that segment.
+static void rematerialize(const NodeVector& forward,
+                          const OutputVector& ys,
+                          const autodiff::CheckpointPolicy& policy,
+                          const std::vector<std::pair<std::shared_ptr<Node>, NodeVector>>& uses)
+{
+    std::unordered_set<Node*> forward_set;
+    for (auto& node : forward)
+    {
+        forward_set.insert(node.get());
+    }
+    std::unordered_set<Node*> checkpoints = select_checkpoints(forward, ys, policy);
+    std::unordered_map<Node*, std::shared_ptr<Node>> recomputed;
+
+    std::function<std::shared_ptr<Node>(Node*, const NodeVector&)> recompute =
+        [&](Node* node, const NodeVector& triggers) -> std::shared_ptr<Node> {
+            if (forward_set.count(node) == 0 || checkpoints.count(node) != 0)
+            {
+                return node->shared_from_this();
+            }
+            auto it = recomputed.find(node);
+            if (it != recomputed.end())
+            {
+                return it->second;
+            }
+            OutputVector args;
+            for (auto value : node->input_values())
+            {
+                args.push_back(
+                    recompute(value.get_node(), triggers)->output(value.get_index()));
+            }
+            auto copy = node->copy_with_new_inputs(args);
+            for (auto& trigger : triggers)
+            {
+                copy->add_control_dependency(trigger);
+            }
+            recomputed[node] = copy;
+            return copy;
+        };
+
+    for (auto& use : uses)
+    {
+        for (auto input : use.first->inputs())
+        {
+            auto source = input.get_source_output();
+            if (forward_set.count(source.get_node()) != 0 &&
+                checkpoints.count(source.get_node()) == 0)
+            {
+                auto copy = recompute(source.get_node(), use.second);
+                input.replace_source_output(copy->output(source.get_index()));
+            }
+        }
+    }
+}
+
+autodiff::Adjoints::Adjoints(const OutputVector& ys,
+                             const OutputVector& cs,
+                             const CheckpointPolicy& policy)
 {
     if (ys.size() != cs.size())
     {
@@ -94,6 +259,26 @@ autodiff::Adjoints::Adjoints(const OutputVector& ys, const OutputVector& cs)
         }
     }
 
+    // With a checkpoint policy, remember the forward graph and which deltas every new
+    // backward node waits for.
+    bool checkpointing = policy.get_type() != CheckpointPolicy::Type::NONE;
+    NodeVector forward;
+    std::unordered_set<Node*> attributed;
+    std::vector<std::pair<std::shared_ptr<Node>, NodeVector>> backward_uses;
+    if (checkpointing)
+    {
+        NodeVector y_nodes;
+        for (auto& y : ys)
+        {
+            y_nodes.push_back(y.get_node_shared_ptr());
+        }
+        forward = topological_sort(y_nodes);
+        for (auto& node : forward)
+        {
+            attributed.insert(node.get());
+        }
+    }
+
     // Second pass visits the nodes so that all users of a node's value are visited
     // before a node is visited.
     for (size_t i = 0; i < ys.size(); i++)
@@ -126,6 +311,7 @@ autodiff::Adjoints::Adjoints(const OutputVector& ys, const OutputVector& cs)
             }
         }
         OutputVector deltas = m_adjoint_map[node.get()];
+        NodeVector triggers;
         for (size_t i = 0; i < node->get_output_size(); ++i)
         {
             auto& delta = deltas[i];
@@ -133,8 +319,47 @@ autodiff::Adjoints::Adjoints(const OutputVector& ys, const OutputVector& cs)
             {
                 delta = make_broadcast_zero(node->output(i));
             }
+            else if (checkpointing)
+            {
+                triggers.push_back(delta.get_node_shared_ptr());
+            }
         }
         node->generate_adjoints(*this, deltas);
+
+        if (checkpointing)
+        {
+            // Everything upstream of the arguments' adjoints that is not yet attributed was
+            // just created by this node's generate_adjoints
+            std::vector<Node*> new_nodes;
+            for (auto value : node->input_values())
+            {
+                for (auto& adjoint : m_adjoint_map[value.get_node()])
+                {
+                    if (adjoint != Output<Node>())
+                    {
+                        new_nodes.push_back(adjoint.get_node());
+                    }
+                }
+            }
+            while (!new_nodes.empty())
+            {
+                Node* new_node = new_nodes.back();
+                new_nodes.pop_back();
+                if (attributed.insert(new_node).second)
+                {
+                    backward_uses.push_back({new_node->shared_from_this(), triggers});
+                    for (auto value : new_node->input_values())
+                    {
+                        new_nodes.push_back(value.get_node());
+                    }
+                }
+            }
+        }
+    }
+
+    if (checkpointing)
+    {
+        rematerialize(forward, ys, policy, backward_uses);
     }
 }
 
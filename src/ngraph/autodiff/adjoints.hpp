@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <map>
 #include <memory>
 #include <unordered_map>
@@ -34,6 +35,44 @@ namespace ngraph
 
     namespace autodiff
     {
+        /// \brief Chooses which forward values the backprop graph keeps.
+        ///
+        /// Forward values that are not checkpoints are recomputed from the nearest
+        /// checkpoints when the backward pass reaches them, so only the checkpoints and one
+        /// recomputed segment are live at a time. Parameters, constants and stateful ops are
+        /// always kept.
+        class CheckpointPolicy
+        {
+        public:
+            enum class Type
+            {
+                // Keep every forward value
+                NONE,
+                // Keep every k-th forward op
+                EVERY_K,
+                // Keep every sqrt(N)-th of the N forward ops
+                SQRT_N,
+                // Keep an op when the values since the last checkpoint exceed a byte budget
+                MEMORY_BUDGET
+            };
+
+            CheckpointPolicy() = default;
+
+            static CheckpointPolicy every(size_t k);
+            static CheckpointPolicy sqrt_n();
+            /// \brief Bounds the bytes recomputed in one segment by `bytes`. The checkpoints
+            ///        themselves are not counted against it.
+            static CheckpointPolicy memory_budget(size_t bytes);
+
+            Type get_type() const { return m_type; }
+            size_t get_interval() const { return m_interval; }
+            size_t get_budget() const { return m_budget; }
+        private:
+            Type m_type{Type::NONE};
+            size_t m_interval{0};
+            size_t m_budget{0};
+        };
+
         class Adjoints
         {
         public:
@@ -41,7 +80,10 @@ namespace ngraph
             ///
             /// \param y The dependent value
             /// \param c An expression for where to evaluate the derivatives
-            Adjoints(const OutputVector& y, const OutputVector& c);
+            /// \param policy Which forward values to keep rather than recompute
+            Adjoints(const OutputVector& y,
+                     const OutputVector& c,
+                     const CheckpointPolicy& policy = CheckpointPolicy());
 
             Adjoints(const Adjoints& adjoints) = default;
             Adjoints& operator=(const Adjoints& adjoints) = default;
@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 #include <iostream>
+#include <sstream>
 #include <string>
 
 #include <clang/Basic/DiagnosticOptions.h>
@@ -35,6 +36,7 @@
 #include <clang/Lex/PreprocessorOptions.h>
 #include <llvm/ADT/Statistic.h>
 #include <llvm/ExecutionEngine/MCJIT.h> // forces JIT to link in
+#include <llvm/IR/LLVMContext.h>
 #include <llvm/IR/Module.h>
 #include <llvm/LinkAllPasses.h>
 #include <llvm/Option/Arg.h>
@@ -49,6 +51,7 @@
 
 #include "header_resource.hpp"
 #include "ngraph/codegen/compiler.hpp"
+#include "ngraph/codegen/module_cache.hpp"
 #include "ngraph/env_util.hpp"
 #include "ngraph/file_util.hpp"
 #include "ngraph/log.hpp"
@@ -96,8 +99,12 @@ public:
     }
 } s_static_init;
 
-codegen::Module::Module(std::unique_ptr<llvm::Module> module)
+codegen::Module::Module(std::unique_ptr<llvm::Module> module,
+                        const std::string& cache_directory,
+                        const std::string& cache_key)
     : m_module(move(module))
+    , m_cache_directory(cache_directory)
+    , m_cache_key(cache_key)
 {
 }
 
@@ -112,6 +119,7 @@ std::unique_ptr<llvm::Module> codegen::Module::take_module()
 
 codegen::Compiler::Compiler()
     : m_compiler_core{}
+    , m_cache_directory(getenv_string("NGRAPH_COMPILER_CACHE_DIR"))
 {
 }
 
@@ -119,6 +127,7 @@ codegen::Compiler::~Compiler()
 {
     m_compiler_action = nullptr;
     m_compiler_core = nullptr;
+    m_cache_context = nullptr;
 }
 
 void codegen::Compiler::set_precompiled_header_source(const std::string& source)
@@ -144,7 +153,31 @@ std::unique_ptr<codegen::Module> codegen::Compiler::compile(const std::string& s
         }
         compiler_info.compiler->set_precompiled_header_source(m_precompiled_header_source);
     }
+    if (m_cache_directory.empty())
+    {
+        return compiler_info.compiler->compile(m_compiler_action, source);
+    }
+
+    ModuleCache cache(m_cache_directory);
+    std::string key = ModuleCache::get_key(source, compiler_info.compiler->get_configuration());
+    if (!m_cache_context)
+    {
+        m_cache_context.reset(new LLVMContext());
+    }
+    std::unique_ptr<llvm::Module> cached = cache.load_module(key, *m_cache_context);
+    if (cached)
+    {
+        return unique_ptr<codegen::Module>(
+            new codegen::Module(move(cached), m_cache_directory, key));
+    }
+
     auto rc = compiler_info.compiler->compile(m_compiler_action, source);
+    if (rc)
+    {
+        std::unique_ptr<llvm::Module> module = rc->take_module();
+        cache.store_module(key, *module);
+        rc.reset(new codegen::Module(move(module), m_cache_directory, key));
+    }
     return rc;
 }
 
@@ -200,6 +233,8 @@ void codegen::CompilerCore::initialize()
     args.push_back("-DNGRAPH_USE_LEGACY_MKLDNN");
 #endif
 
+    m_args.assign(args.begin(), args.end());
+
     // Prepare DiagnosticEngine
     IntrusiveRefCntPtr<DiagnosticOptions> diag_options = new DiagnosticOptions();
     diag_options->ErrorLimit = 20;
@@ -610,6 +645,53 @@ const std::string& codegen::CompilerCore::get_precompiled_header_source() const
     return m_precompiled_header_source;
 }
 
+// The built-in headers change with every rebuild of nGraph and its dependencies
+static const std::string& get_builtin_headers_hash()
+{
+    static const std::string hash = []() {
+        std::string headers;
+#ifdef _WIN32
+        for (const pair<std::string, vector<std::string>>& header_info : builtin_headers)
+        {
+            headers += header_info.first;
+            for (const std::string& line : header_info.second)
+            {
+                headers += line;
+            }
+        }
+#else
+        for (const pair<std::string, std::string>& header_info : builtin_headers)
+        {
+            headers += header_info.first;
+            headers += header_info.second;
+        }
+#endif
+        return codegen::ModuleCache::get_key(headers, "");
+    }();
+    return hash;
+}
+
+std::string codegen::CompilerCore::get_configuration() const
+{
+    // Language and code generation options are fixed in initialize(), the arguments, search
+    // paths, target CPU and debug info are what can vary between builds and hosts
+    std::stringstream ss;
+    ss << NGRAPH_VERSION << "\n";
+    ss << "headers=" << get_builtin_headers_hash() << "\n";
+    ss << "cpu=" << m_compiler->getInvocation().getTargetOpts().CPU << "\n";
+    ss << "debuginfo=" << m_debuginfo_enabled << "\n";
+    for (const std::string& arg : m_args)
+    {
+        ss << "arg=" << arg << "\n";
+    }
+    for (const std::string& path : m_extra_search_path_list)
+    {
+        ss << "include=" << path << "\n";
+    }
+    ss << "pch=" << m_precompiled_header_source;
+    return ss.str();
+}
+
 int codegen::CompilerCore::full_version_number(const std::string& path, const std::string& gpp_ver)
 {
     // check if header version is compatible with g++ version
@@ -38,18 +38,26 @@ namespace clang
 
 namespace llvm
 {
+    class LLVMContext;
     class Module;
 }
 
 class ngraph::codegen::Module
 {
 public:
-    Module(std::unique_ptr<llvm::Module> module);
+    Module(std::unique_ptr<llvm::Module> module,
+           const std::string& cache_directory = "",
+           const std::string& cache_key = "");
     ~Module();
     std::unique_ptr<llvm::Module> take_module();
 
+    /// \brief Module cache the object code should be stored in, empty if not cached.
+    const std::string& get_cache_directory() const { return m_cache_directory; }
+    const std::string& get_cache_key() const { return m_cache_key; }
 private:
     std::unique_ptr<llvm::Module> m_module;
+    std::string m_cache_directory;
+    std::string m_cache_key;
 };
 
 class ngraph::codegen::Compiler
@@ -59,6 +67,10 @@ public:
     ~Compiler();
     void set_precompiled_header_source(const std::string& source);
     void add_header_search_path(const std::string& path);
+    /// \brief Directory of the compiled module cache, an empty path disables caching.
+    ///        Defaults to the NGRAPH_COMPILER_CACHE_DIR environment variable.
+    void set_cache_directory(const std::string& path) { m_cache_directory = path; }
+    const std::string& get_cache_directory() const { return m_cache_directory; }
     std::unique_ptr<ngraph::codegen::Module> compile(const std::string& source);
     std::unique_ptr<clang::CodeGenAction>& get_compiler_action() { return m_compiler_action; }
 private:
@@ -66,6 +78,9 @@ private:
     std::shared_ptr<CompilerCore> m_compiler_core;
     std::string m_precompiled_header_source;
     std::vector<std::string> m_header_search_paths;
+    std::string m_cache_directory;
+    // Owns modules loaded from the cache
+    std::unique_ptr<llvm::LLVMContext> m_cache_context;
 };
 
 class ngraph::codegen::CompilerCore
@@ -84,6 +99,8 @@ public:
         compile(std::unique_ptr<clang::CodeGenAction>& compiler_action, const std::string& source);
     std::string generate_pch(const std::string& source);
     void initialize();
+    /// \brief Everything besides the source that changes the compiled module.
+    std::string get_configuration() const;
 
 private:
     std::unique_ptr<clang::CompilerInstance> m_compiler;
@@ -93,6 +110,7 @@ private:
     std::string m_source_name;
     std::vector<std::string> m_extra_search_path_list;
     std::string m_precompiled_header_source;
+    std::vector<std::string> m_args;
 #ifdef _WIN32
     std::vector<std::string> m_header_strings;
 #endif
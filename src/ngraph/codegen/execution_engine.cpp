@@ -15,8 +15,10 @@
 //*****************************************************************************
 
 #include <llvm/ExecutionEngine/ExecutionEngine.h>
+#include <llvm/ExecutionEngine/ObjectCache.h>
 
 #include "ngraph/codegen/execution_engine.hpp"
+#include "ngraph/codegen/module_cache.hpp"
 
 using namespace ngraph;
 
@@ -51,6 +53,12 @@ bool codegen::ExecutionEngine::add_module(std::unique_ptr<ngraph::codegen::Modul
             {
                 return false;
             }
+            if (!module->get_cache_key().empty())
+            {
+                ModuleCache cache(module->get_cache_directory());
+                m_object_cache = cache.make_object_cache(module->get_cache_key());
+                m_execution_engine->setObjectCache(m_object_cache.get());
+            }
         }
     }
     else
@@ -0,0 +1,157 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <llvm/ADT/StringExtras.h>
+#include <llvm/Bitcode/BitcodeReader.h>
+#include <llvm/Bitcode/BitcodeWriter.h>
+#include <llvm/Config/llvm-config.h>
+#include <llvm/ExecutionEngine/ObjectCache.h>
+#include <llvm/IR/Module.h>
+#include <llvm/Support/Error.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/SHA1.h>
+#include <llvm/Support/raw_ostream.h>
+
+#include "ngraph/codegen/module_cache.hpp"
+#include "ngraph/file_util.hpp"
+#include "ngraph/log.hpp"
+
+using namespace llvm;
+using namespace std;
+using namespace ngraph;
+
+// Writes data next to path and renames it into place so readers never see partial entries
+static void write_atomic(const std::string& path, StringRef data)
+{
+    int fd;
+    SmallString<128> tmp_path;
+    if (sys::fs::createUniqueFile(path + "-%%%%%%.tmp", fd, tmp_path))
+    {
+        NGRAPH_DEBUG << "Unable to create codegen cache entry " << path;
+        return;
+    }
+    {
+        raw_fd_ostream out(fd, true);
+        out << data;
+        out.close();
+        if (out.has_error())
+        {
+            out.clear_error();
+            sys::fs::remove(tmp_path);
+            return;
+        }
+    }
+    if (sys::fs::rename(tmp_path, path))
+    {
+        sys::fs::remove(tmp_path);
+    }
+}
+
+namespace
+{
+    class DiskObjectCache : public llvm::ObjectCache
+    {
+    public:
+        DiskObjectCache(const std::string& path)
+            : m_path(path)
+        {
+        }
+
+        void notifyObjectCompiled(const llvm::Module*, MemoryBufferRef object) override
+        {
+            write_atomic(m_path, object.getBuffer());
+        }
+
+        std::unique_ptr<MemoryBuffer> getObject(const llvm::Module*) override
+        {
+            auto buffer = MemoryBuffer::getFile(m_path);
+            if (!buffer)
+            {
+                return nullptr;
+            }
+            NGRAPH_DEBUG << "Loaded codegen object " << m_path;
+            return move(*buffer);
+        }
+
+    private:
+        std::string m_path;
+    };
+}
+
+codegen::ModuleCache::ModuleCache(const std::string& directory)
+    : m_directory(directory)
+{
+}
+
+std::string codegen::ModuleCache::get_key(const std::string& source,
+                                          const std::string& configuration)
+{
+    SHA1 hasher;
+    hasher.update(LLVM_VERSION_STRING);
+    hasher.update(StringRef("\0", 1));
+    hasher.update(configuration);
+    hasher.update(StringRef("\0", 1));
+    hasher.update(source);
+    return toHex(hasher.final(), true);
+}
+
+std::string codegen::ModuleCache::get_path(const std::string& key,
+                                           const std::string& extension) const
+{
+    return file_util::path_join(m_directory, key + extension);
+}
+
+std::unique_ptr<llvm::Module> codegen::ModuleCache::load_module(const std::string& key,
+                                                                LLVMContext& context) const
+{
+    std::string path = get_path(key, ".bc");
+    auto buffer = MemoryBuffer::getFile(path);
+    if (!buffer)
+    {
+        return nullptr;
+    }
+    auto module = parseBitcodeFile((*buffer)->getMemBufferRef(), context);
+    if (!module)
+    {
+        NGRAPH_WARN << "Ignoring unreadable codegen cache entry " << path << ": "
+                    << toString(module.takeError());
+        return nullptr;
+    }
+    NGRAPH_DEBUG << "Loaded codegen module " << path;
+    return move(*module);
+}
+
+void codegen::ModuleCache::store_module(const std::string& key, const llvm::Module& module) const
+{
+    if (sys::fs::create_directories(m_directory))
+    {
+        NGRAPH_WARN << "Unable to create codegen cache directory " << m_directory;
+        return;
+    }
+    std::string bitcode;
+    {
+        raw_string_ostream out(bitcode);
+        WriteBitcodeToFile(module, out);
+    }
+    write_atomic(get_path(key, ".bc"), bitcode);
+}
+
+std::unique_ptr<llvm::ObjectCache>
+    codegen::ModuleCache::make_object_cache(const std::string& key) const
+{
+    return std::unique_ptr<llvm::ObjectCache>(new DiskObjectCache(get_path(key, ".o")));
+}
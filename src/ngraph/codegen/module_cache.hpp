@@ -0,0 +1,63 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+namespace ngraph
+{
+    namespace codegen
+    {
+        class ModuleCache;
+    }
+}
+
+namespace llvm
+{
+    class LLVMContext;
+    class Module;
+    class ObjectCache;
+}
+
+/// \brief On-disk, content addressed cache of compiled codegen modules.
+///
+/// Each entry is keyed on a hash of the generated source and everything else that affects
+/// the compiled result. It stores the optimized bitcode, which replaces the clang front end
+/// and optimizer, and the JIT object code, which replaces LLVM code generation. Entries are
+/// written to a temporary file and renamed so concurrent processes can share a directory.
+class ngraph::codegen::ModuleCache
+{
+public:
+    ModuleCache(const std::string& directory);
+
+    /// \brief Returns the cache key for source compiled under configuration.
+    static std::string get_key(const std::string& source, const std::string& configuration);
+
+    /// \brief Returns the cached module for key or nullptr if there is none.
+    std::unique_ptr<llvm::Module> load_module(const std::string& key,
+                                              llvm::LLVMContext& context) const;
+    void store_module(const std::string& key, const llvm::Module& module) const;
+
+    /// \brief Returns an object cache for the JIT that reads and writes key's object code.
+    std::unique_ptr<llvm::ObjectCache> make_object_cache(const std::string& key) const;
+
+private:
+    std::string get_path(const std::string& key, const std::string& extension) const;
+
+    std::string m_directory;
+};
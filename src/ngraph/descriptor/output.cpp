@@ -33,19 +33,20 @@ descriptor::Output::Output(Node* node, size_t index, const shared_ptr<Tensor>& t
 // Add an input to the vector of inputs that use this output.
 void descriptor::Output::add_input(Input* input)
 {
-    // Keep the inputs in insertion order to keep sorts deterministic
-    if (find(m_inputs.begin(), m_inputs.end(), input) == m_inputs.end())
-    {
-        m_inputs.push_back(input);
-    }
+    // Keep the inputs in insertion order to keep sorts deterministic. An input is connected to
+    // one output at a time and removes itself before reconnecting, so it is never added twice;
+    // skipping the duplicate search keeps outputs with very many users (shared weights in
+    // unrolled graphs) from making graph construction quadratic.
+    m_inputs.push_back(input);
 }
 
 void descriptor::Output::remove_input(Input* input)
 {
-    auto it = find(m_inputs.begin(), m_inputs.end(), input);
-    if (it != m_inputs.end())
+    // Search from the back: the most recently connected users are usually the first to go
+    auto it = find(m_inputs.rbegin(), m_inputs.rend(), input);
+    if (it != m_inputs.rend())
     {
-        m_inputs.erase(it);
+        m_inputs.erase(std::next(it).base());
     }
 }
 
@@ -16,6 +16,10 @@
 
 #include "ngraph/distributed.hpp"
 #include "ngraph/distributed/null.hpp"
+#ifndef _WIN32
+#include "ngraph/distributed/shared_memory.hpp"
+#endif
+#include "ngraph/env_util.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/type.hpp"
 
@@ -52,6 +56,14 @@ void ngraph::set_distributed_interface(std::unique_ptr<DistributedInterface> dis
 
 DistributedInterface* ngraph::get_distributed_interface()
 {
+#ifndef _WIN32
+    // Ranks launched on one host with NGRAPH_DISTRIBUTED_SIZE/RANK set talk through shared memory
+    if (nullptr == s_distributed_interface && getenv_int("NGRAPH_DISTRIBUTED_SIZE", 0) > 0)
+    {
+        set_distributed_interface(
+            std::unique_ptr<DistributedInterface>(new ngraph::distributed::SharedMemory()));
+    }
+#endif
     if (nullptr == s_distributed_interface)
     {
         set_distributed_interface(
@@ -0,0 +1,489 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <fcntl.h>
+#include <new>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <thread>
+#include <unistd.h>
+
+#include "ngraph/distributed/shared_memory.hpp"
+#include "ngraph/env_util.hpp"
+#include "ngraph/except.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/type/bfloat16.hpp"
+#include "ngraph/type/float16.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+constexpr size_t distributed::SharedMemory::s_default_slot_bytes;
+constexpr size_t distributed::SharedMemory::s_channel_bytes;
+
+static constexpr uint64_t s_magic = 0x6e67726170687368; // "ngraphsh"
+static constexpr size_t s_cache_line = 64;
+static constexpr int s_attach_timeout_ms = 60000;
+
+struct distributed::SharedMemory::Header
+{
+    alignas(s_cache_line) atomic<uint64_t> magic;
+    alignas(s_cache_line) atomic<uint32_t> barrier_count;
+    alignas(s_cache_line) atomic<uint32_t> barrier_sense;
+};
+
+// Single producer, single consumer mailbox. posted and consumed count whole chunks, the
+// buffer holds one chunk and follows the struct in the mapping.
+struct distributed::SharedMemory::Channel
+{
+    alignas(s_cache_line) atomic<uint64_t> posted;
+    alignas(s_cache_line) atomic<uint64_t> consumed;
+};
+
+static size_t round_up(size_t value, size_t alignment)
+{
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+template <typename PRED>
+static void spin_until(PRED pred)
+{
+    for (size_t spins = 0; !pred(); ++spins)
+    {
+        if (spins > 1024)
+        {
+            this_thread::yield();
+        }
+    }
+}
+
+template <typename T>
+static void reduce_into(T* acc, const T* arg, size_t count, reduction::Type reduce_type)
+{
+    switch (reduce_type)
+    {
+    case reduction::Type::SUM:
+        for (size_t i = 0; i < count; ++i)
+        {
+            acc[i] = static_cast<T>(acc[i] + arg[i]);
+        }
+        break;
+    case reduction::Type::PROD:
+        for (size_t i = 0; i < count; ++i)
+        {
+            acc[i] = static_cast<T>(acc[i] * arg[i]);
+        }
+        break;
+    case reduction::Type::MIN:
+        for (size_t i = 0; i < count; ++i)
+        {
+            acc[i] = arg[i] < acc[i] ? arg[i] : acc[i];
+        }
+        break;
+    case reduction::Type::MAX:
+        for (size_t i = 0; i < count; ++i)
+        {
+            acc[i] = acc[i] < arg[i] ? arg[i] : acc[i];
+        }
+        break;
+    }
+}
+
+static void reduce_into(void* acc,
+                        const void* arg,
+                        size_t count,
+                        element::Type_t element_type,
+                        reduction::Type reduce_type)
+{
+    switch (element_type)
+    {
+    case element::Type_t::bf16:
+        reduce_into(static_cast<bfloat16*>(acc),
+                    static_cast<const bfloat16*>(arg),
+                    count,
+                    reduce_type);
+        break;
+    case element::Type_t::f16:
+        reduce_into(
+            static_cast<float16*>(acc), static_cast<const float16*>(arg), count, reduce_type);
+        break;
+    case element::Type_t::f32:
+        reduce_into(static_cast<float*>(acc), static_cast<const float*>(arg), count, reduce_type);
+        break;
+    case element::Type_t::f64:
+        reduce_into(
+            static_cast<double*>(acc), static_cast<const double*>(arg), count, reduce_type);
+        break;
+    case element::Type_t::i8:
+        reduce_into(
+            static_cast<int8_t*>(acc), static_cast<const int8_t*>(arg), count, reduce_type);
+        break;
+    case element::Type_t::i16:
+        reduce_into(
+            static_cast<int16_t*>(acc), static_cast<const int16_t*>(arg), count, reduce_type);
+        break;
+    case element::Type_t::i32:
+        reduce_into(
+            static_cast<int32_t*>(acc), static_cast<const int32_t*>(arg), count, reduce_type);
+        break;
+    case element::Type_t::i64:
+        reduce_into(
+            static_cast<int64_t*>(acc), static_cast<const int64_t*>(arg), count, reduce_type);
+        break;
+    case element::Type_t::u8:
+        reduce_into(
+            static_cast<uint8_t*>(acc), static_cast<const uint8_t*>(arg), count, reduce_type);
+        break;
+    case element::Type_t::u16:
+        reduce_into(
+            static_cast<uint16_t*>(acc), static_cast<const uint16_t*>(arg), count, reduce_type);
+        break;
+    case element::Type_t::u32:
+        reduce_into(
+            static_cast<uint32_t*>(acc), static_cast<const uint32_t*>(arg), count, reduce_type);
+        break;
+    case element::Type_t::u64:
+        reduce_into(
+            static_cast<uint64_t*>(acc), static_cast<const uint64_t*>(arg), count, reduce_type);
+        break;
+    case element::Type_t::undefined:
+    case element::Type_t::dynamic:
+    case element::Type_t::boolean:
+    case element::Type_t::u1:
+        throw ngraph_error("Shared memory all_reduce: unsupported element type " +
+                           element::Type(element_type).get_type_name());
+    }
+}
+
+distributed::SharedMemory::SharedMemory()
+    : SharedMemory(getenv_string("NGRAPH_DISTRIBUTED_SHM_NAME"),
+                   getenv_int("NGRAPH_DISTRIBUTED_SIZE"),
+                   getenv_int("NGRAPH_DISTRIBUTED_RANK"))
+{
+}
+
+distributed::SharedMemory::SharedMemory(const string& name, int size, int rank, size_t slot_bytes)
+    : m_size(size)
+    , m_rank(rank)
+    , m_slot_bytes(round_up(slot_bytes, s_cache_line))
+{
+    if (m_size <= 0 || m_rank < 0 || m_rank >= m_size)
+    {
+        throw ngraph_error("Shared memory distributed interface: invalid rank " +
+                           to_string(m_rank) + " for size " + to_string(m_size));
+    }
+    if (m_slot_bytes == 0)
+    {
+        throw ngraph_error("Shared memory distributed interface: slot size must not be zero");
+    }
+    string shm_name = name.empty() ? "ngraph_distributed" : name;
+    if (shm_name[0] != '/')
+    {
+        shm_name = "/" + shm_name;
+    }
+    open(shm_name);
+}
+
+distributed::SharedMemory::~SharedMemory()
+{
+    if (m_mapped != nullptr)
+    {
+        munmap(m_mapped, m_mapped_bytes);
+    }
+}
+
+void distributed::SharedMemory::open(const string& shm_name)
+{
+    size_t slot_region = static_cast<size_t>(m_size) * 2 * m_slot_bytes;
+    m_channel_stride = round_up(sizeof(Channel) + s_channel_bytes, s_cache_line);
+    size_t channel_region = static_cast<size_t>(m_size) * m_size * m_channel_stride;
+    size_t header_bytes = round_up(sizeof(Header), s_cache_line);
+    m_mapped_bytes = header_bytes + slot_region + channel_region;
+
+    int fd = -1;
+    if (m_rank == 0)
+    {
+        // Drop anything left behind by a job that died before every rank attached
+        shm_unlink(shm_name.c_str());
+        fd = shm_open(shm_name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+        if (fd < 0 || ftruncate(fd, static_cast<off_t>(m_mapped_bytes)) != 0)
+        {
+            string error = strerror(errno);
+            if (fd >= 0)
+            {
+                close(fd);
+                shm_unlink(shm_name.c_str());
+            }
+            throw ngraph_error("Unable to create shared memory '" + shm_name + "': " + error);
+        }
+    }
+    else
+    {
+        auto deadline = chrono::steady_clock::now() + chrono::milliseconds(s_attach_timeout_ms);
+        while (true)
+        {
+            fd = shm_open(shm_name.c_str(), O_RDWR, 0);
+            if (fd >= 0)
+            {
+                struct stat info;
+                if (fstat(fd, &info) == 0 &&
+                    static_cast<size_t>(info.st_size) == m_mapped_bytes)
+                {
+                    break;
+                }
+                close(fd);
+                fd = -1;
+            }
+            if (chrono::steady_clock::now() > deadline)
+            {
+                throw ngraph_error("Timed out waiting for rank 0 to create shared memory '" +
+                                   shm_name + "'");
+            }
+            this_thread::sleep_for(chrono::milliseconds(1));
+        }
+    }
+
+    m_mapped = mmap(nullptr, m_mapped_bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (m_mapped == MAP_FAILED)
+    {
+        m_mapped = nullptr;
+        if (m_rank == 0)
+        {
+            shm_unlink(shm_name.c_str());
+        }
+        throw ngraph_error("Unable to map shared memory '" + shm_name + "': " + strerror(errno));
+    }
+
+    uint8_t* base = static_cast<uint8_t*>(m_mapped);
+    m_header = reinterpret_cast<Header*>(base);
+    m_slots = base + header_bytes;
+    m_channels = m_slots + slot_region;
+
+    if (m_rank == 0)
+    {
+        new (m_header) Header();
+        m_header->barrier_count.store(0, memory_order_relaxed);
+        m_header->barrier_sense.store(0, memory_order_relaxed);
+        for (int src = 0; src < m_size; ++src)
+        {
+            for (int dest = 0; dest < m_size; ++dest)
+            {
+                Channel* channel = new (get_channel(src, dest)) Channel();
+                channel->posted.store(0, memory_order_relaxed);
+                channel->consumed.store(0, memory_order_relaxed);
+            }
+        }
+        if (!m_header->magic.is_lock_free() || !m_header->barrier_count.is_lock_free())
+        {
+            shm_unlink(shm_name.c_str());
+            throw ngraph_error("Shared memory distributed interface requires lock-free atomics");
+        }
+        m_header->magic.store(s_magic, memory_order_release);
+    }
+    else
+    {
+        spin_until([&]() { return m_header->magic.load(memory_order_acquire) == s_magic; });
+    }
+
+    barrier();
+    if (m_rank == 0)
+    {
+        // Every rank holds a mapping now, the name is no longer needed
+        shm_unlink(shm_name.c_str());
+    }
+    NGRAPH_DEBUG << "Attached to shared memory '" << shm_name << "' as rank " << m_rank << " of "
+                 << m_size;
+}
+
+void distributed::SharedMemory::barrier()
+{
+    m_barrier_sense ^= 1;
+    if (m_header->barrier_count.fetch_add(1, memory_order_acq_rel) + 1 ==
+        static_cast<uint32_t>(m_size))
+    {
+        m_header->barrier_count.store(0, memory_order_relaxed);
+        m_header->barrier_sense.store(m_barrier_sense, memory_order_release);
+    }
+    else
+    {
+        spin_until([&]() {
+            return m_header->barrier_sense.load(memory_order_acquire) == m_barrier_sense;
+        });
+    }
+}
+
+uint8_t* distributed::SharedMemory::get_slot(int rank, size_t half) const
+{
+    return m_slots + (static_cast<size_t>(rank) * 2 + half) * m_slot_bytes;
+}
+
+distributed::SharedMemory::Channel* distributed::SharedMemory::get_channel(int src_id,
+                                                                            int dest_id) const
+{
+    size_t index = static_cast<size_t>(src_id) * m_size + dest_id;
+    return reinterpret_cast<Channel*>(m_channels + index * m_channel_stride);
+}
+
+const string& distributed::SharedMemory::get_name() const
+{
+    return m_name;
+}
+
+int distributed::SharedMemory::get_size()
+{
+    return m_size;
+}
+
+int distributed::SharedMemory::get_rank()
+{
+    return m_rank;
+}
+
+void distributed::SharedMemory::all_reduce(void* in,
+                                           void* out,
+                                           element::Type_t element_type,
+                                           reduction::Type reduce_type,
+                                           size_t count)
+{
+    size_t element_size = element::Type(element_type).size();
+    size_t chunk_count = m_slot_bytes / element_size;
+    const uint8_t* src = static_cast<const uint8_t*>(in);
+    uint8_t* dst = static_cast<uint8_t*>(out);
+
+    for (size_t offset = 0; offset < count; offset += chunk_count)
+    {
+        size_t n = min(chunk_count, count - offset);
+        size_t half = m_next_half;
+        m_next_half ^= 1;
+
+        memcpy(get_slot(m_rank, half), src + offset * element_size, n * element_size);
+        barrier();
+
+        // Reduce-scatter: this rank owns [begin, end) of the chunk and folds every rank's
+        // contribution into it, always in rank order.
+        size_t begin = n * m_rank / m_size;
+        size_t end = n * (m_rank + 1) / m_size;
+        size_t bytes = (end - begin) * element_size;
+        uint8_t* acc = dst + (offset + begin) * element_size;
+        memcpy(acc, get_slot(0, half) + begin * element_size, bytes);
+        for (int rank = 1; rank < m_size; ++rank)
+        {
+            reduce_into(acc,
+                        get_slot(rank, half) + begin * element_size,
+                        end - begin,
+                        element_type,
+                        reduce_type);
+        }
+        memcpy(get_slot(m_rank, half) + begin * element_size, acc, bytes);
+        barrier();
+
+        // All-gather the segments reduced by the other ranks
+        for (int rank = 0; rank < m_size; ++rank)
+        {
+            if (rank != m_rank)
+            {
+                size_t seg_begin = n * rank / m_size;
+                size_t seg_end = n * (rank + 1) / m_size;
+                memcpy(dst + (offset + seg_begin) * element_size,
+                       get_slot(rank, half) + seg_begin * element_size,
+                       (seg_end - seg_begin) * element_size);
+            }
+        }
+    }
+}
+
+void distributed::SharedMemory::broadcast(void* in,
+                                          element::Type_t element_type,
+                                          size_t count,
+                                          int root_id)
+{
+    if (root_id < 0 || root_id >= m_size)
+    {
+        throw ngraph_error("Shared memory broadcast: invalid root " + to_string(root_id));
+    }
+    size_t element_size = element::Type(element_type).size();
+    size_t chunk_count = m_slot_bytes / element_size;
+    uint8_t* data = static_cast<uint8_t*>(in);
+
+    for (size_t offset = 0; offset < count; offset += chunk_count)
+    {
+        size_t bytes = min(chunk_count, count - offset) * element_size;
+        size_t half = m_next_half;
+        m_next_half ^= 1;
+
+        if (m_rank == root_id)
+        {
+            memcpy(get_slot(root_id, half), data + offset * element_size, bytes);
+        }
+        barrier();
+        if (m_rank != root_id)
+        {
+            memcpy(data + offset * element_size, get_slot(root_id, half), bytes);
+        }
+    }
+}
+
+void distributed::SharedMemory::recv(void* in,
+                                     element::Type_t element_type,
+                                     size_t count,
+                                     int src_id)
+{
+    if (src_id < 0 || src_id >= m_size || src_id == m_rank)
+    {
+        throw ngraph_error("Shared memory recv: invalid source " + to_string(src_id));
+    }
+    Channel* channel = get_channel(src_id, m_rank);
+    const uint8_t* buffer = reinterpret_cast<const uint8_t*>(channel + 1);
+    uint8_t* data = static_cast<uint8_t*>(in);
+    size_t total = count * element::Type(element_type).size();
+
+    for (size_t offset = 0; offset < total; offset += s_channel_bytes)
+    {
+        uint64_t consumed = channel->consumed.load(memory_order_relaxed);
+        spin_until([&]() { return channel->posted.load(memory_order_acquire) > consumed; });
+        memcpy(data + offset, buffer, min(s_channel_bytes, total - offset));
+        channel->consumed.store(consumed + 1, memory_order_release);
+    }
+}
+
+void distributed::SharedMemory::send(const void* in,
+                                     element::Type_t element_type,
+                                     size_t count,
+                                     int dest_id)
+{
+    if (dest_id < 0 || dest_id >= m_size || dest_id == m_rank)
+    {
+        throw ngraph_error("Shared memory send: invalid destination " + to_string(dest_id));
+    }
+    Channel* channel = get_channel(m_rank, dest_id);
+    uint8_t* buffer = reinterpret_cast<uint8_t*>(channel + 1);
+    const uint8_t* data = static_cast<const uint8_t*>(in);
+    size_t total = count * element::Type(element_type).size();
+
+    for (size_t offset = 0; offset < total; offset += s_channel_bytes)
+    {
+        uint64_t posted = channel->posted.load(memory_order_relaxed);
+        spin_until([&]() { return channel->consumed.load(memory_order_acquire) == posted; });
+        memcpy(buffer, data + offset, min(s_channel_bytes, total - offset));
+        channel->posted.store(posted + 1, memory_order_release);
+    }
+}
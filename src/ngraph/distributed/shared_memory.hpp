@@ -0,0 +1,106 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "ngraph/distributed.hpp"
+
+namespace ngraph
+{
+    namespace distributed
+    {
+        /// \brief DistributedInterface for ranks running as separate processes on one host.
+        ///
+        /// All ranks map the same POSIX shared memory object and synchronize through
+        /// lock-free atomics placed in it. all_reduce is a reduce-scatter followed by an
+        /// all-gather: every rank reduces its own segment of each chunk and then copies the
+        /// reduced segments of all the other ranks. Chunks alternate between two halves of
+        /// each rank's slot so the copy-in of one chunk overlaps the copy-out of the previous
+        /// one. Every element is reduced in rank order, so all ranks see bit-identical results.
+        ///
+        /// The default constructor reads the job layout from the environment:
+        ///     NGRAPH_DISTRIBUTED_SIZE     number of ranks
+        ///     NGRAPH_DISTRIBUTED_RANK     rank of this process, in [0, size)
+        ///     NGRAPH_DISTRIBUTED_SHM_NAME name of the shared memory object (optional)
+        class NGRAPH_API SharedMemory : public DistributedInterface
+        {
+        public:
+            SharedMemory();
+            /// \param name Name of the shared memory object, unique per job.
+            /// \param size Number of ranks.
+            /// \param rank Rank of this process.
+            /// \param slot_bytes Bytes each rank stages per all_reduce/broadcast chunk.
+            SharedMemory(const std::string& name,
+                         int size,
+                         int rank,
+                         size_t slot_bytes = s_default_slot_bytes);
+            ~SharedMemory() override;
+
+            SharedMemory(const SharedMemory&) = delete;
+            SharedMemory& operator=(const SharedMemory&) = delete;
+
+            const std::string& get_name() const override;
+            int get_size() override;
+            int get_rank() override;
+            void all_reduce(void* in,
+                            void* out,
+                            element::Type_t element_type,
+                            reduction::Type reduce_type,
+                            size_t count) override;
+
+            void broadcast(void* in,
+                           element::Type_t element_type,
+                           size_t count,
+                           int root_id) override;
+
+            void recv(void* in, element::Type_t element_type, size_t count, int src_id) override;
+
+            void send(const void* in,
+                      element::Type_t element_type,
+                      size_t count,
+                      int dest_id) override;
+
+            static constexpr size_t s_default_slot_bytes = 1 << 20;
+            static constexpr size_t s_channel_bytes = 1 << 16;
+
+        private:
+            struct Header;
+            struct Channel;
+
+            void open(const std::string& shm_name);
+            void barrier();
+            uint8_t* get_slot(int rank, size_t half) const;
+            Channel* get_channel(int src_id, int dest_id) const;
+
+            std::string m_name{"SHM"};
+            int m_size;
+            int m_rank;
+            size_t m_slot_bytes;
+            size_t m_channel_stride{0};
+            size_t m_mapped_bytes{0};
+            void* m_mapped{nullptr};
+            Header* m_header{nullptr};
+            uint8_t* m_slots{nullptr};
+            uint8_t* m_channels{nullptr};
+            uint32_t m_barrier_sense{0};
+            size_t m_next_half{0};
+        };
+    }
+}
@@ -43,6 +43,24 @@ Function::Function(const ResultVector& results,
     init();
 }
 
+Function::Function(const ResultVector& results,
+                   const ParameterVector& parameters,
+                   const std::string& name,
+                   bool validate_nodes)
+    : Lambda(results, parameters)
+    , m_temporary_pool_size(0)
+    , m_instance_id(m_next_instance_id.fetch_add(1))
+    , m_name(name)
+    , m_unique_name("Function_" + to_string(m_instance_id))
+    , m_topological_sorter(topological_sort<std::vector<std::shared_ptr<Node>>>)
+{
+    if (validate_nodes)
+    {
+        validate_nodes_and_infer_types();
+    }
+    check_all_parameters_registered();
+}
+
 Function::Function(const OutputVector& results,
                    const ParameterVector& parameters,
                    const std::string& name)
@@ -87,7 +105,11 @@ void Function::validate_nodes_and_infer_types()
 void Function::init()
 {
     validate_nodes_and_infer_types();
+    check_all_parameters_registered();
+}
 
+void Function::check_all_parameters_registered() const
+{
     traverse_nodes(this, [&](shared_ptr<Node> node) {
         if (node->is_parameter())
         {
@@ -52,6 +52,14 @@ namespace ngraph
                  const ParameterVector& parameters,
                  const std::string& name = "");
 
+        /// \brief Constructs a function without revalidating its nodes. Only for use when
+        ///        every node was validated by its constructor against its current inputs, as
+        ///        is the case for a freshly cloned or specialized graph.
+        Function(const ResultVector& results,
+                 const ParameterVector& parameters,
+                 const std::string& name,
+                 bool validate_nodes);
+
         void init();
 
         virtual ~Function() {}
@@ -134,6 +142,8 @@ namespace ngraph
         size_t m_temporary_pool_size;
 
     private:
+        void check_all_parameters_registered() const;
+
         Function(const Function&) = delete;
         Function(const Function&&) = delete;
         Function& operator=(const Function&) = delete;
@@ -30,6 +30,7 @@
 #include "ngraph/op/parameter.hpp"
 #include "ngraph/op/result.hpp"
 #include "ngraph/pass/manager.hpp"
+#include "ngraph/pass/pass_profile.hpp"
 #include "ngraph/pass/visualize_tree.hpp"
 #include "ngraph/provenance.hpp"
 #include "ngraph/util.hpp"
@@ -82,7 +83,7 @@ void ngraph::traverse_nodes(const NodeVector& subgraph_results,
         if (instances_seen.insert(n).second)
         {
             f(n->shared_from_this());
-            for (size_t i = 0; i < n->inputs().size(); i++)
+            for (size_t i = 0; i < n->get_input_size(); i++)
             {
                 stack.push(n->get_input_node_ptr(i));
             }
@@ -194,6 +195,7 @@ void ngraph::replace_node(std::shared_ptr<Node> target,
 
     replacement->add_node_control_dependents(target);
     target->clear_control_dependents();
+    pass::CompileProfile::record_rewrite();
 }
 
 void ngraph::replace_node(const std::shared_ptr<Node>& target,
@@ -224,6 +226,7 @@ void ngraph::replace_node(const std::shared_ptr<Node>& target,
         target->output(i).replace(replacement_values.at(i));
     }
     target->clear_control_dependents();
+    pass::CompileProfile::record_rewrite();
 }
 
 void ngraph::replace_node(std::shared_ptr<Node> target, std::shared_ptr<Node> replacement)
@@ -292,12 +295,29 @@ bool ngraph::is_post_dominated(Node* X, Node* Y)
     return true;
 }
 
-std::vector<std::shared_ptr<ngraph::Node>>
-    ngraph::clone_nodes(const std::vector<std::shared_ptr<ngraph::Node>>& nodes, NodeMap& node_map)
+bool ngraph::is_validated_copy(const Node& original, const Node& copy)
 {
-    // for each node in topological order
-    auto sorted_nodes = topological_sort(nodes);
-    for (auto node : sorted_nodes)
+    if (original.get_output_size() != copy.get_output_size())
+    {
+        return false;
+    }
+    for (size_t i = 0; i < original.get_output_size(); ++i)
+    {
+        if ((copy.get_output_element_type(i).is_dynamic() &&
+             original.get_output_element_type(i).is_static()) ||
+            !copy.get_output_partial_shape(i).refines(original.get_output_partial_shape(i)))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void clone_sorted_nodes(const std::vector<std::shared_ptr<Node>>& sorted_nodes,
+                               NodeMap& node_map)
+{
+    node_map.reserve(node_map.size() + sorted_nodes.size());
+    for (auto& node : sorted_nodes)
     {
         if (node_map.count(node.get()) == 0)
         {
@@ -319,6 +339,10 @@ std::vector<std::shared_ptr<ngraph::Node>>
                 }
             }
             auto cloned_node = node->copy_with_new_inputs(cloned_args, cloned_dependencies);
+            if (!is_validated_copy(*node, *cloned_node))
+            {
+                cloned_node->revalidate_and_infer_types();
+            }
             if (node->get_friendly_name() != node->get_name())
             {
                 // There is a friendly name for this node so copy it
@@ -334,6 +358,13 @@ std::vector<std::shared_ptr<ngraph::Node>>
             node_map[node.get()] = cloned_node;
         }
     }
+}
+
+std::vector<std::shared_ptr<ngraph::Node>>
+    ngraph::clone_nodes(const std::vector<std::shared_ptr<ngraph::Node>>& nodes, NodeMap& node_map)
+{
+    // for each node in topological order
+    clone_sorted_nodes(topological_sort(nodes), node_map);
 
     // create and return vector of cloned nodes
     // order matches input vector (not necessarily topological)
@@ -418,8 +449,8 @@ std::shared_ptr<ngraph::Function> ngraph::clone_function(const ngraph::Function&
 std::shared_ptr<ngraph::Function> ngraph::clone_function(const ngraph::Function& func,
                                                          NodeMap& node_map)
 {
-    // clone function operations
-    clone_nodes(func.get_ops(), node_map);
+    // clone function operations; get_ordered_ops is already in topological order
+    clone_sorted_nodes(func.get_ordered_ops(), node_map);
 
     // get cloned function results and parameters
     ResultVector cloned_results;
@@ -438,8 +469,8 @@ std::shared_ptr<ngraph::Function> ngraph::clone_function(const ngraph::Function&
         cloned_params.push_back(as_type_ptr<op::Parameter>(node_map.at(param.get())));
     }
 
-    // create and return cloned function
-    return std::make_shared<ngraph::Function>(cloned_results, cloned_params);
+    // create and return cloned function; clone_nodes has already validated every node
+    return std::make_shared<ngraph::Function>(cloned_results, cloned_params, "", false);
 }
 
 bool ngraph::is_equal_to_const_value(std::string const_value, const Output<Node>& reduce_constant)
@@ -383,6 +383,11 @@ namespace ngraph
 
     bool is_equal_to_const_value(std::string const_value, const Output<Node>& reduce_constant);
 
+    // Nodes validate themselves when constructed, so every output of a copy is at least as
+    // specific as the original's. Copies of nodes that defer validation (such as TensorIterator)
+    // are not, and must be validated once they are complete.
+    bool is_validated_copy(const Node& original, const Node& copy);
+
     // input nodes are cloned and returned
     // NodeMap input may contain default node mapping i.e. pre-cloned nodes
     // NodeMap output (by reference) fully maps input and cloned nodes
@@ -27,6 +27,7 @@
 #include "ngraph/op/get_output_element.hpp"
 #include "ngraph/op/parameter.hpp"
 #include "ngraph/op/result.hpp"
+#include "ngraph/pass/pass_profile.hpp"
 #include "ngraph/pattern/matcher.hpp"
 #include "ngraph/placement.hpp"
 
@@ -226,6 +227,7 @@ void Node::set_argument(size_t position, const Output<Node>& argument)
 void Node::constructor_validate_and_infer_types()
 {
 #ifdef IN_TRANSITION
+    pass::CompileProfile::ValidateScope validate_scope;
     validate_and_infer_types();
 #endif
 }
@@ -238,6 +240,12 @@ void Node::delayed_validate_and_infer_types()
 }
 #undef IN_TRANSITION
 
+void Node::revalidate_and_infer_types()
+{
+    pass::CompileProfile::ValidateScope validate_scope;
+    validate_and_infer_types();
+}
+
 void Node::set_output_size(size_t n)
 {
     NGRAPH_CHECK(n >= m_outputs.size(), "shrinking ", m_outputs.size(), " to ", n);
@@ -275,12 +283,12 @@ void Node::set_output_type(size_t i, const element::Type& element_type, const Pa
     get_output_descriptor(i).get_tensor_ptr()->set_tensor_type(element_type, pshape);
 }
 
-std::deque<descriptor::Output>& Node::get_outputs()
+Node::OutputDescriptors& Node::get_outputs()
 {
     return m_outputs;
 }
 
-const std::deque<descriptor::Output>& Node::get_outputs() const
+const Node::OutputDescriptors& Node::get_outputs() const
 {
     return m_outputs;
 }
@@ -340,14 +348,42 @@ void Node::set_placement(Placement placement)
     m_placement = placement;
 }
 
+Node::Metadata& Node::get_metadata()
+{
+    if (!m_metadata)
+    {
+        m_metadata.reset(new Metadata());
+    }
+    return *m_metadata;
+}
+
+const Node::Metadata& Node::get_metadata() const
+{
+    static const Metadata empty;
+    return m_metadata ? *m_metadata : empty;
+}
+
+Node::RTMap& Node::get_rt_info()
+{
+    return get_metadata().rt_info;
+}
+
+const Node::RTMap& Node::get_rt_info() const
+{
+    return get_metadata().rt_info;
+}
+
 void Node::add_provenance_group_member(const shared_ptr<Node>& node)
 {
-    m_provenance_group.insert(node);
+    get_metadata().provenance_group.insert(node);
 }
 
 void Node::remove_provenance_group_member(const shared_ptr<Node>& node)
 {
-    m_provenance_group.erase(node);
+    if (m_metadata)
+    {
+        m_metadata->provenance_group.erase(node);
+    }
 }
 
 void Node::replace_provenance_group_member(const shared_ptr<Node>& current_node,
@@ -366,7 +402,7 @@ void Node::replace_provenance_group_member(const shared_ptr<Node>& current_node,
 
 const set<shared_ptr<Node>>& Node::get_provenance_group_members() const
 {
-    return m_provenance_group;
+    return get_metadata().provenance_group;
 }
 
 shared_ptr<Node> Node::add_provenance_group_members_above(const OutputVector& base)
@@ -398,7 +434,7 @@ shared_ptr<Node> Node::add_provenance_group_members_above(const OutputVector& ba
         add_provenance_group_member(node->shared_from_this());
         for (auto value : node->input_values())
         {
-            if (m_provenance_group.count(value.get_node_shared_ptr()) == 0)
+            if (get_metadata().provenance_group.count(value.get_node_shared_ptr()) == 0)
             {
                 todo.push_back(value.get_node());
             }
@@ -436,13 +472,14 @@ void Node::add_provenance_tags_above(const OutputVector& base,
 
 const std::unordered_set<std::string>& Node::get_provenance_tags() const
 {
-    return m_provenance_tags;
+    return get_metadata().provenance_tags;
 }
 
 void Node::add_provenance_tag(const std::string& tag)
 {
-    m_provenance_tags.insert(tag);
-    for (auto node : m_provenance_group)
+    auto& metadata = get_metadata();
+    metadata.provenance_tags.insert(tag);
+    for (auto node : metadata.provenance_group)
     {
         node->add_provenance_tag(tag);
     }
@@ -450,7 +487,10 @@ void Node::add_provenance_tag(const std::string& tag)
 
 void Node::remove_provenance_tag(const std::string& tag)
 {
-    m_provenance_tags.erase(tag);
+    if (m_metadata)
+    {
+        m_metadata->provenance_tags.erase(tag);
+    }
 }
 
 void Node::merge_provenance_tags_from(const std::shared_ptr<const Node>& source)
@@ -299,6 +299,21 @@ op::Constant::Constant(const element::Type& type, const Shape& shape, const void
     m_all_elements_bitwise_identical = are_all_data_elements_bitwise_identical();
 }
 
+op::Constant::Constant(const element::Type& type,
+                       const Shape& shape,
+                       const shared_ptr<runtime::AlignedBuffer>& data)
+    : m_element_type(type)
+    , m_shape(shape)
+    , m_data(data)
+{
+    size_t size = (shape_size(m_shape) * m_element_type.bitwidth() + 7) / 8;
+    NGRAPH_CHECK(m_data && m_data->size() >= size,
+                 "Buffer is too small for a constant of shape ",
+                 m_shape);
+    constructor_validate_and_infer_types();
+    m_all_elements_bitwise_identical = are_all_data_elements_bitwise_identical();
+}
+
 op::Constant::Constant(const Constant& other)
     : m_element_type(other.m_element_type)
     , m_shape(other.m_shape)
@@ -312,6 +327,17 @@ op::Constant::~Constant()
 {
 }
 
+void* op::Constant::get_data_ptr_nc()
+{
+    if (m_data && m_data.use_count() > 1)
+    {
+        auto data = make_shared<runtime::AlignedBuffer>(m_data->size(), host_alignment());
+        std::memcpy(data->get_ptr(), m_data->get_ptr(), m_data->size());
+        m_data = data;
+    }
+    return (m_data ? m_data->get_ptr() : nullptr);
+}
+
 string op::Constant::convert_value_to_string(size_t index) const
 {
     string rc;
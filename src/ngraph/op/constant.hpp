@@ -93,6 +93,16 @@ namespace ngraph
                 /// \param data A void* to constant data.
                 Constant(const element::Type& type, const Shape& shape, const void* data);
 
+                /// \brief Constructs a tensor constant that takes over the supplied buffer
+                ///        instead of copying it
+                ///
+                /// \param type The element type of the tensor constant.
+                /// \param shape The shape of the tensor constant.
+                /// \param data A buffer holding the constant data.
+                Constant(const element::Type& type,
+                         const Shape& shape,
+                         const std::shared_ptr<runtime::AlignedBuffer>& data);
+
                 Constant(const Constant& other);
                 Constant& operator=(const Constant&) = delete;
 
@@ -295,7 +305,9 @@ namespace ngraph
                 std::string convert_value_to_string(size_t index) const;
 
             protected:
-                void* get_data_ptr_nc() { return (m_data ? m_data->get_ptr() : nullptr); }
+                /// \brief Returns a writable pointer to the data. Copies of a Constant share
+                ///        their data buffer, so a shared buffer is copied before it is returned.
+                void* get_data_ptr_nc();
                 Constant(const OutputVector& args)
                     : Op(args)
                     , m_shape({})
@@ -18,6 +18,7 @@
 #include "ngraph/graph_util.hpp"
 #include "ngraph/pass/get_output_element_elimination.hpp"
 #include "ngraph/specialize_function.hpp"
+#include "ngraph/validation_util.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -291,7 +292,8 @@ void op::TensorIterator::validate_and_infer_types()
             if (input_partial_shape.is_static())
             {
                 auto input_shape = input_partial_shape.to_shape();
-                auto axis = slice_input_description->m_axis;
+                auto axis = ngraph::normalize_axis(
+                    this, slice_input_description->m_axis, input_partial_shape.rank());
                 auto part_size = slice_input_description->m_part_size;
 
                 auto dim_size = input_shape[axis];
@@ -410,7 +412,8 @@ void op::TensorIterator::validate_and_infer_types()
             {
                 auto body_value_shape = body_value_partial_shape.to_shape();
                 auto part_size = concat_output_description->m_part_size;
-                auto axis = concat_output_description->m_axis;
+                auto axis = ngraph::normalize_axis(
+                    this, concat_output_description->m_axis, body_value_partial_shape.rank());
 
                 Shape out_shape{body_value_shape};
                 if (m_num_iterations != -1)
@@ -453,8 +456,10 @@ std::shared_ptr<Node> op::TensorIterator::copy_with_new_args(const NodeVector& n
                     if (auto slice_in = ::ngraph::as_type_ptr<
                             ngraph::op::TensorIterator::SliceInputDescription>(input_description))
                     {
-                        new_shapes[slice_in->m_body_parameter_index][slice_in->m_axis] =
-                            slice_in->m_part_size;
+                        auto& new_shape = new_shapes[slice_in->m_body_parameter_index];
+                        auto axis =
+                            ngraph::normalize_axis(this, slice_in->m_axis, new_shape.rank());
+                        new_shape[axis] = slice_in->m_part_size;
                     }
                 }
             }
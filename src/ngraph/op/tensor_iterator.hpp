@@ -264,6 +264,8 @@ namespace ngraph
 
                 std::shared_ptr<Node> copy_with_new_args(const NodeVector& new_args) const override;
                 NodeVector decompose_op() const override;
+                /// Backends run the body as a loop, there is no decomposition.
+                bool supports_decompose() const override { return false; }
                 /// \return the body of the iteration
                 std::shared_ptr<BodyLambda> get_body() const { return m_body; }
                 /// \param body set the body of the iteration
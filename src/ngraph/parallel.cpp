@@ -0,0 +1,102 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <thread>
+#include <vector>
+
+#include "ngraph/env_util.hpp"
+#include "ngraph/parallel.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static size_t get_default_pass_thread_count()
+{
+    int32_t thread_count = getenv_int("NGRAPH_PASS_THREADS", 1);
+    if (thread_count == 0)
+    {
+        thread_count = static_cast<int32_t>(thread::hardware_concurrency());
+    }
+    return max<int32_t>(thread_count, 1);
+}
+
+static atomic<size_t> s_pass_thread_count{get_default_pass_thread_count()};
+static thread_local bool s_in_parallel_for = false;
+
+void ngraph::set_pass_thread_count(size_t thread_count)
+{
+    s_pass_thread_count = max<size_t>(thread_count, 1);
+}
+
+size_t ngraph::get_pass_thread_count()
+{
+    return s_pass_thread_count;
+}
+
+void ngraph::parallel_for(size_t begin,
+                          size_t end,
+                          size_t grain_size,
+                          const function<void(size_t, size_t)>& f)
+{
+    if (end <= begin)
+    {
+        return;
+    }
+    size_t size = end - begin;
+    size_t range_count =
+        min(s_pass_thread_count.load(), max<size_t>(size / max<size_t>(grain_size, 1), 1));
+    if (range_count == 1 || s_in_parallel_for)
+    {
+        f(begin, end);
+        return;
+    }
+
+    vector<exception_ptr> errors(range_count);
+    auto run_range = [&](size_t range) {
+        s_in_parallel_for = true;
+        try
+        {
+            f(begin + size * range / range_count, begin + size * (range + 1) / range_count);
+        }
+        catch (...)
+        {
+            errors[range] = current_exception();
+        }
+        s_in_parallel_for = false;
+    };
+
+    vector<thread> threads;
+    threads.reserve(range_count - 1);
+    for (size_t range = 1; range < range_count; range++)
+    {
+        threads.emplace_back(run_range, range);
+    }
+    run_range(0);
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+    for (auto& error : errors)
+    {
+        if (error)
+        {
+            rethrow_exception(error);
+        }
+    }
+}
@@ -0,0 +1,42 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+#include "ngraph/ngraph_visibility.hpp"
+
+namespace ngraph
+{
+    /// \brief Sets the number of threads that compile-time work, such as constant folding and
+    ///        node-local passes, may use. The default is taken from NGRAPH_PASS_THREADS, where 0
+    ///        selects the number of hardware threads. Without it everything runs on the calling
+    ///        thread.
+    NGRAPH_API void set_pass_thread_count(size_t thread_count);
+    NGRAPH_API size_t get_pass_thread_count();
+
+    /// \brief Splits [begin, end) into at most get_pass_thread_count() contiguous ranges of at
+    ///        least \p grain_size indices and calls \p f(range_begin, range_end) for each range
+    ///        on its own thread, the first range on the calling thread. Calls made from within
+    ///        \p f run serially. The first exception thrown by \p f is rethrown once all ranges
+    ///        are done.
+    NGRAPH_API void parallel_for(size_t begin,
+                                 size_t end,
+                                 size_t grain_size,
+                                 const std::function<void(size_t, size_t)>& f);
+}
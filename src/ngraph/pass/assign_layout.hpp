@@ -30,6 +30,7 @@ namespace ngraph
         class AssignLayout : public NodePass
         {
         public:
+            AssignLayout() { set_property(PassProperty::NODE_LOCAL, true); }
             virtual bool run_on_node(std::shared_ptr<Node> node) override
             {
                 try
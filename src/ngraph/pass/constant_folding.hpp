@@ -27,6 +27,20 @@ namespace ngraph
     {
         class ConstantFolding;
         bool revalidate_and_ensure_static(std::shared_ptr<ngraph::Node> n);
+
+        /// \brief Elements a thread folds at least when folding is split across threads (see
+        ///        set_pass_thread_count)
+        const size_t constant_folding_grain_size = 1 << 16;
+
+        /// \brief Reorders the axes of `in` into `out` by `input_order`, as the Reshape and
+        ///        Transpose folds do. Elements are moved as raw words of `element_size` bytes.
+        ///        When the leading axis stays in place the output is split across threads.
+        void reshape_constant_data(const void* in,
+                                   void* out,
+                                   size_t element_size,
+                                   const Shape& in_shape,
+                                   const AxisVector& input_order,
+                                   const Shape& out_shape);
     }
 }
 
@@ -31,6 +31,7 @@
 #include "ngraph/op/power.hpp"
 #include "ngraph/op/subtract.hpp"
 #include "ngraph/op/xor.hpp"
+#include "ngraph/parallel.hpp"
 #include "ngraph/runtime/reference/add.hpp"
 #include "ngraph/runtime/reference/and.hpp"
 #include "ngraph/runtime/reference/divide.hpp"
@@ -51,14 +52,54 @@
 using namespace std;
 using namespace ngraph;
 
+static void evaluate_binary_logical(const char* a,
+                                    const char* b,
+                                    char* out,
+                                    const Shape& a_shape,
+                                    const Shape& b_shape,
+                                    const op::AutoBroadcastSpec& autob,
+                                    shared_ptr<Node> binary)
+{
+    if (is_type<op::v0::And>(binary))
+    {
+        runtime::reference::logical_and<char>(a, b, out, a_shape, b_shape, autob);
+    }
+    else if (is_type<op::v1::LogicalAnd>(binary))
+    {
+        runtime::reference::logical_and<char>(a, b, out, a_shape, b_shape, autob);
+    }
+    else if (is_type<op::v0::Or>(binary))
+    {
+        runtime::reference::logical_or<char>(a, b, out, a_shape, b_shape, autob);
+    }
+    else if (is_type<op::v1::LogicalOr>(binary))
+    {
+        runtime::reference::logical_or<char>(a, b, out, a_shape, b_shape, autob);
+    }
+    else if (is_type<op::v0::Xor>(binary))
+    {
+        runtime::reference::logical_xor<char>(a, b, out, a_shape, b_shape, autob);
+    }
+    else if (is_type<op::v1::LogicalXor>(binary))
+    {
+        runtime::reference::logical_xor<char>(a, b, out, a_shape, b_shape, autob);
+    }
+    else
+    {
+        NGRAPH_CHECK(
+            false,
+            "fold_constant_binary_logical must be consistent with is_supported_binary_op");
+    }
+}
+
 static shared_ptr<op::Constant> fold_constant_binary_logical(shared_ptr<op::Constant> a,
                                                              shared_ptr<op::Constant> b,
                                                              shared_ptr<Node> binary,
                                                              NodeExecutorTy func)
 {
     const Shape& out_shape = binary->get_shape();
-    runtime::AlignedBuffer buffer(shape_size(out_shape) * sizeof(char));
-    char* data_ptr = buffer.get_ptr<char>();
+    auto buffer = make_shared<runtime::AlignedBuffer>(shape_size(out_shape) * sizeof(char));
+    char* data_ptr = buffer->get_ptr<char>();
 
     // NOTE: We will skip the executor if the shapes do not match, because that means
     // auto-broadcast is in use, and the CPU functors don't yet support that.
@@ -71,82 +112,96 @@ static shared_ptr<op::Constant> fold_constant_binary_logical(shared_ptr<op::Cons
         outputs.push_back(data_ptr);
 
         func(inputs, outputs);
-        return make_shared<op::Constant>(binary->get_output_element_type(0), out_shape, data_ptr);
+    }
+    else if (a->get_shape() == b->get_shape())
+    {
+        // Without broadcasting the op is elementwise over the flattened tensors
+        auto evaluate_range = [&](size_t begin, size_t end) {
+            Shape range_shape{end - begin};
+            evaluate_binary_logical(a->get_data_ptr<char>() + begin,
+                                    b->get_data_ptr<char>() + begin,
+                                    data_ptr + begin,
+                                    range_shape,
+                                    range_shape,
+                                    op::AutoBroadcastSpec(),
+                                    binary);
+        };
+        parallel_for(0, shape_size(out_shape), pass::constant_folding_grain_size, evaluate_range);
     }
     else
     {
-        if (auto and_v0_node = as_type_ptr<op::v0::And>(binary))
-        {
-            runtime::reference::logical_and<char>(a->get_data_ptr<char>(),
-                                                  b->get_data_ptr<char>(),
-                                                  data_ptr,
-                                                  a->get_shape(),
-                                                  b->get_shape(),
-                                                  and_v0_node->get_autob());
-            return make_shared<op::Constant>(
-                binary->get_output_element_type(0), out_shape, data_ptr);
-        }
-        else if (auto logical_and_node = as_type_ptr<op::v1::LogicalAnd>(binary))
-        {
-            runtime::reference::logical_and<char>(a->get_data_ptr<char>(),
-                                                  b->get_data_ptr<char>(),
-                                                  data_ptr,
-                                                  a->get_shape(),
-                                                  b->get_shape(),
-                                                  logical_and_node->get_autob());
-            return make_shared<op::Constant>(
-                binary->get_output_element_type(0), out_shape, data_ptr);
-        }
-        else if (auto or_node = as_type_ptr<op::v0::Or>(binary))
-        {
-            runtime::reference::logical_or<char>(a->get_data_ptr<char>(),
-                                                 b->get_data_ptr<char>(),
-                                                 data_ptr,
-                                                 a->get_shape(),
-                                                 b->get_shape(),
-                                                 or_node->get_autob());
-            return make_shared<op::Constant>(
-                binary->get_output_element_type(0), out_shape, data_ptr);
-        }
-        else if (auto logical_or_node = as_type_ptr<op::v1::LogicalOr>(binary))
-        {
-            runtime::reference::logical_or<char>(a->get_data_ptr<char>(),
-                                                 b->get_data_ptr<char>(),
-                                                 data_ptr,
-                                                 a->get_shape(),
-                                                 b->get_shape(),
-                                                 logical_or_node->get_autob());
-            return make_shared<op::Constant>(
-                binary->get_output_element_type(0), out_shape, data_ptr);
-        }
-        else if (auto xor_node = as_type_ptr<op::v0::Xor>(binary))
-        {
-            runtime::reference::logical_xor<char>(a->get_data_ptr<char>(),
-                                                  b->get_data_ptr<char>(),
-                                                  data_ptr,
-                                                  a->get_shape(),
-                                                  b->get_shape(),
-                                                  xor_node->get_autob());
-            return make_shared<op::Constant>(
-                binary->get_output_element_type(0), out_shape, data_ptr);
-        }
-        else if (auto logical_xor_node = as_type_ptr<op::v1::LogicalXor>(binary))
-        {
-            runtime::reference::logical_xor<char>(a->get_data_ptr<char>(),
-                                                  b->get_data_ptr<char>(),
-                                                  data_ptr,
-                                                  a->get_shape(),
-                                                  b->get_shape(),
-                                                  logical_xor_node->get_autob());
-            return make_shared<op::Constant>(
-                binary->get_output_element_type(0), out_shape, data_ptr);
-        }
-        else
-        {
-            NGRAPH_CHECK(
-                false,
-                "fold_constant_binary_logical must be consistent with is_supported_binary_op");
-        }
+        evaluate_binary_logical(a->get_data_ptr<char>(),
+                                b->get_data_ptr<char>(),
+                                data_ptr,
+                                a->get_shape(),
+                                b->get_shape(),
+                                binary->get_autob(),
+                                binary);
+    }
+    return make_shared<op::Constant>(binary->get_output_element_type(0), out_shape, buffer);
+}
+
+template <class Tin>
+static void evaluate_binary_comparison(const Tin* a,
+                                       const Tin* b,
+                                       char* out,
+                                       const Shape& a_shape,
+                                       const Shape& b_shape,
+                                       const op::AutoBroadcastSpec& autob,
+                                       shared_ptr<Node> binary)
+{
+    if (is_type<op::v0::Equal>(binary))
+    {
+        runtime::reference::equal<Tin>(a, b, out, a_shape, b_shape, autob);
+    }
+    else if (is_type<op::v1::Equal>(binary))
+    {
+        runtime::reference::equal<Tin>(a, b, out, a_shape, b_shape, autob);
+    }
+    else if (is_type<op::v0::Greater>(binary))
+    {
+        runtime::reference::greater<Tin>(a, b, out, a_shape, b_shape, autob);
+    }
+    else if (is_type<op::v1::Greater>(binary))
+    {
+        runtime::reference::greater<Tin>(a, b, out, a_shape, b_shape, autob);
+    }
+    else if (is_type<op::v0::GreaterEq>(binary))
+    {
+        runtime::reference::greater_eq<Tin>(a, b, out, a_shape, b_shape, autob);
+    }
+    else if (is_type<op::v1::GreaterEqual>(binary))
+    {
+        runtime::reference::greater_eq<Tin>(a, b, out, a_shape, b_shape, autob);
+    }
+    else if (is_type<op::v0::Less>(binary))
+    {
+        runtime::reference::less<Tin>(a, b, out, a_shape, b_shape, autob);
+    }
+    else if (is_type<op::v1::Less>(binary))
+    {
+        runtime::reference::less<Tin>(a, b, out, a_shape, b_shape, autob);
+    }
+    else if (is_type<op::v0::LessEq>(binary))
+    {
+        runtime::reference::less_eq<Tin>(a, b, out, a_shape, b_shape, autob);
+    }
+    else if (is_type<op::v1::LessEqual>(binary))
+    {
+        runtime::reference::less_eq<Tin>(a, b, out, a_shape, b_shape, autob);
+    }
+    else if (is_type<op::v0::NotEqual>(binary))
+    {
+        runtime::reference::not_equal<Tin>(a, b, out, a_shape, b_shape, autob);
+    }
+    else if (is_type<op::v1::NotEqual>(binary))
+    {
+        runtime::reference::not_equal<Tin>(a, b, out, a_shape, b_shape, autob);
+    }
+    else
+    {
+        NGRAPH_CHECK(false,
+                     "fold_constant_binary must be consistent with is_supported_binary_op");
     }
 }
 
@@ -157,8 +212,8 @@ shared_ptr<op::Constant> fold_constant_binary_comparison(shared_ptr<op::Constant
                                                          NodeExecutorTy func)
 {
     const Shape& out_shape = binary->get_shape();
-    runtime::AlignedBuffer buffer(shape_size(out_shape) * sizeof(char));
-    char* data_ptr = buffer.get_ptr<char>();
+    auto buffer = make_shared<runtime::AlignedBuffer>(shape_size(out_shape) * sizeof(char));
+    char* data_ptr = buffer->get_ptr<char>();
 
     // NOTE: We will skip the executor if the shapes do not match, because that means
     // auto-broadcast is in use, and the CPU functors don't yet support that.
@@ -171,147 +226,138 @@ shared_ptr<op::Constant> fold_constant_binary_comparison(shared_ptr<op::Constant
         outputs.push_back(data_ptr);
 
         func(inputs, outputs);
-        return make_shared<op::Constant>(binary->get_output_element_type(0), out_shape, data_ptr);
+    }
+    else if (a->get_shape() == b->get_shape())
+    {
+        // Without broadcasting the op is elementwise over the flattened tensors
+        auto evaluate_range = [&](size_t begin, size_t end) {
+            Shape range_shape{end - begin};
+            evaluate_binary_comparison<Tin>(a->get_data_ptr<Tin>() + begin,
+                                            b->get_data_ptr<Tin>() + begin,
+                                            data_ptr + begin,
+                                            range_shape,
+                                            range_shape,
+                                            op::AutoBroadcastSpec(),
+                                            binary);
+        };
+        parallel_for(0, shape_size(out_shape), pass::constant_folding_grain_size, evaluate_range);
     }
     else
     {
-        if (auto equal_v0_node = as_type_ptr<op::v0::Equal>(binary))
-        {
-            runtime::reference::equal<Tin>(a->get_data_ptr<Tin>(),
-                                           b->get_data_ptr<Tin>(),
-                                           data_ptr,
-                                           a->get_shape(),
-                                           b->get_shape(),
-                                           equal_v0_node->get_autob());
-            return make_shared<op::Constant>(
-                binary->get_output_element_type(0), out_shape, data_ptr);
-        }
-        else if (auto equal_v1_node = as_type_ptr<op::v1::Equal>(binary))
-        {
-            runtime::reference::equal<Tin>(a->get_data_ptr<Tin>(),
-                                           b->get_data_ptr<Tin>(),
-                                           data_ptr,
-                                           a->get_shape(),
-                                           b->get_shape(),
-                                           equal_v1_node->get_autob());
-            return make_shared<op::Constant>(
-                binary->get_output_element_type(0), out_shape, data_ptr);
-        }
-        else if (auto greater_v0_node = as_type_ptr<op::v0::Greater>(binary))
-        {
-            runtime::reference::greater<Tin>(a->get_data_ptr<Tin>(),
-                                             b->get_data_ptr<Tin>(),
-                                             data_ptr,
-                                             a->get_shape(),
-                                             b->get_shape(),
-                                             greater_v0_node->get_autob());
-            return make_shared<op::Constant>(
-                binary->get_output_element_type(0), out_shape, data_ptr);
-        }
-        else if (auto greater_v1_node = as_type_ptr<op::v1::Greater>(binary))
-        {
-            runtime::reference::greater<Tin>(a->get_data_ptr<Tin>(),
-                                             b->get_data_ptr<Tin>(),
-                                             data_ptr,
-                                             a->get_shape(),
-                                             b->get_shape(),
-                                             greater_v1_node->get_autob());
-            return make_shared<op::Constant>(
-                binary->get_output_element_type(0), out_shape, data_ptr);
-        }
-        else if (auto greater_eq_v0_node = as_type_ptr<op::v0::GreaterEq>(binary))
-        {
-            runtime::reference::greater_eq<Tin>(a->get_data_ptr<Tin>(),
-                                                b->get_data_ptr<Tin>(),
-                                                data_ptr,
-                                                a->get_shape(),
-                                                b->get_shape(),
-                                                greater_eq_v0_node->get_autob());
-            return make_shared<op::Constant>(
-                binary->get_output_element_type(0), out_shape, data_ptr);
-        }
-        else if (auto greater_eq_v1_node = as_type_ptr<op::v1::GreaterEqual>(binary))
-        {
-            runtime::reference::greater_eq<Tin>(a->get_data_ptr<Tin>(),
-                                                b->get_data_ptr<Tin>(),
-                                                data_ptr,
-                                                a->get_shape(),
-                                                b->get_shape(),
-                                                greater_eq_v1_node->get_autob());
-            return make_shared<op::Constant>(
-                binary->get_output_element_type(0), out_shape, data_ptr);
-        }
-        else if (auto less_v0_node = as_type_ptr<op::v0::Less>(binary))
-        {
-            runtime::reference::less<Tin>(a->get_data_ptr<Tin>(),
-                                          b->get_data_ptr<Tin>(),
-                                          data_ptr,
-                                          a->get_shape(),
-                                          b->get_shape(),
-                                          less_v0_node->get_autob());
-            return make_shared<op::Constant>(
-                binary->get_output_element_type(0), out_shape, data_ptr);
-        }
-        else if (auto less_v1_node = as_type_ptr<op::v1::Less>(binary))
-        {
-            runtime::reference::less<Tin>(a->get_data_ptr<Tin>(),
-                                          b->get_data_ptr<Tin>(),
-                                          data_ptr,
-                                          a->get_shape(),
-                                          b->get_shape(),
-                                          less_v1_node->get_autob());
-            return make_shared<op::Constant>(
-                binary->get_output_element_type(0), out_shape, data_ptr);
-        }
-        else if (auto less_eq_v0_node = as_type_ptr<op::v0::LessEq>(binary))
-        {
-            runtime::reference::less_eq<Tin>(a->get_data_ptr<Tin>(),
-                                             b->get_data_ptr<Tin>(),
-                                             data_ptr,
-                                             a->get_shape(),
-                                             b->get_shape(),
-                                             less_eq_v0_node->get_autob());
-            return make_shared<op::Constant>(
-                binary->get_output_element_type(0), out_shape, data_ptr);
-        }
-        else if (auto less_eq_v1_node = as_type_ptr<op::v1::LessEqual>(binary))
-        {
-            runtime::reference::less_eq<Tin>(a->get_data_ptr<Tin>(),
-                                             b->get_data_ptr<Tin>(),
-                                             data_ptr,
-                                             a->get_shape(),
-                                             b->get_shape(),
-                                             less_eq_v1_node->get_autob());
-            return make_shared<op::Constant>(
-                binary->get_output_element_type(0), out_shape, data_ptr);
-        }
-        else if (auto not_equal_v0_node = as_type_ptr<op::v0::NotEqual>(binary))
-        {
-            runtime::reference::not_equal<Tin>(a->get_data_ptr<Tin>(),
-                                               b->get_data_ptr<Tin>(),
-                                               data_ptr,
-                                               a->get_shape(),
-                                               b->get_shape(),
-                                               not_equal_v0_node->get_autob());
-            return make_shared<op::Constant>(
-                binary->get_output_element_type(0), out_shape, data_ptr);
-        }
-        else if (auto not_equal_v1_node = as_type_ptr<op::v1::NotEqual>(binary))
-        {
-            runtime::reference::not_equal<Tin>(a->get_data_ptr<Tin>(),
-                                               b->get_data_ptr<Tin>(),
-                                               data_ptr,
-                                               a->get_shape(),
-                                               b->get_shape(),
-                                               not_equal_v1_node->get_autob());
-            return make_shared<op::Constant>(
-                binary->get_output_element_type(0), out_shape, data_ptr);
-        }
-        else
-        {
-            NGRAPH_CHECK(false,
-                         "fold_constant_binary must be consistent with is_supported_binary_op");
-        }
+        evaluate_binary_comparison<Tin>(a->get_data_ptr<Tin>(),
+                                        b->get_data_ptr<Tin>(),
+                                        data_ptr,
+                                        a->get_shape(),
+                                        b->get_shape(),
+                                        binary->get_autob(),
+                                        binary);
+    }
+    return make_shared<op::Constant>(binary->get_output_element_type(0), out_shape, buffer);
+}
+
+template <class Tin, class Tout = Tin>
+static void evaluate_binary_arithmetic(const Tin* a,
+                                       const Tin* b,
+                                       Tout* out,
+                                       const Shape& a_shape,
+                                       const Shape& b_shape,
+                                       const op::AutoBroadcastSpec& autob,
+                                       shared_ptr<Node> binary)
+{
+    if (is_type<op::v0::Add>(binary))
+    {
+        NGRAPH_CHECK(element::from<Tin>() == element::from<Tout>(),
+                     "Input/output types do not match");
+        runtime::reference::add<Tin>(a, b, out, a_shape, b_shape, autob);
+    }
+    else if (is_type<op::v1::Add>(binary))
+    {
+        NGRAPH_CHECK(element::from<Tin>() == element::from<Tout>(),
+                     "Input/output types do not match");
+        runtime::reference::add<Tin>(a, b, out, a_shape, b_shape, autob);
+    }
+    else if (is_type<op::v0::Divide>(binary))
+    {
+        NGRAPH_CHECK(element::from<Tin>() == element::from<Tout>(),
+                     "Input/output types do not match");
+        shared_ptr<op::v0::Divide> divop = as_type_ptr<op::v0::Divide>(binary);
+        bool pythondiv = divop->is_pythondiv();
+        runtime::reference::divide<Tin>(a, b, out, a_shape, b_shape, autob, pythondiv);
+    }
+    else if (is_type<op::v1::Divide>(binary))
+    {
+        NGRAPH_CHECK(element::from<Tin>() == element::from<Tout>(),
+                     "Input/output types do not match");
+        shared_ptr<op::v1::Divide> divop = as_type_ptr<op::v1::Divide>(binary);
+        bool pythondiv = divop->is_pythondiv();
+        runtime::reference::divide<Tin>(a, b, out, a_shape, b_shape, autob, pythondiv);
+    }
+    else if (is_type<op::v0::Maximum>(binary))
+    {
+        NGRAPH_CHECK(element::from<Tin>() == element::from<Tout>(),
+                     "Input/output types do not match");
+        runtime::reference::maximum<Tin>(a, b, out, a_shape, b_shape, autob);
+    }
+    else if (is_type<op::v1::Maximum>(binary))
+    {
+        NGRAPH_CHECK(element::from<Tin>() == element::from<Tout>(),
+                     "Input/output types do not match");
+        runtime::reference::maximum<Tin>(a, b, out, a_shape, b_shape, autob);
+    }
+    else if (is_type<op::v0::Minimum>(binary))
+    {
+        NGRAPH_CHECK(element::from<Tin>() == element::from<Tout>(),
+                     "Input/output types do not match");
+        runtime::reference::minimum<Tin>(a, b, out, a_shape, b_shape, autob);
+    }
+    else if (is_type<op::v1::Minimum>(binary))
+    {
+        NGRAPH_CHECK(element::from<Tin>() == element::from<Tout>(),
+                     "Input/output types do not match");
+        runtime::reference::minimum<Tin>(a, b, out, a_shape, b_shape, autob);
+    }
+    else if (is_type<op::v0::Multiply>(binary))
+    {
+        NGRAPH_CHECK(element::from<Tin>() == element::from<Tout>(),
+                     "Input/output types do not match");
+        runtime::reference::multiply<Tin>(a, b, out, a_shape, b_shape, autob);
+    }
+    else if (is_type<op::v1::Multiply>(binary))
+    {
+        NGRAPH_CHECK(element::from<Tin>() == element::from<Tout>(),
+                     "Input/output types do not match");
+        runtime::reference::multiply<Tin>(a, b, out, a_shape, b_shape, autob);
+    }
+    else if (is_type<op::v0::Power>(binary))
+    {
+        NGRAPH_CHECK(element::from<Tin>() == element::from<Tout>(),
+                     "Input/output types do not match");
+        shared_ptr<op::v0::Power> powop = as_type_ptr<op::v0::Power>(binary);
+        runtime::reference::power<Tin>(a, b, out, a_shape, b_shape, autob);
+    }
+    else if (is_type<op::v1::Power>(binary))
+    {
+        NGRAPH_CHECK(element::from<Tin>() == element::from<Tout>(),
+                     "Input/output types do not match");
+        shared_ptr<op::v1::Power> powop = as_type_ptr<op::v1::Power>(binary);
+        runtime::reference::power<Tin>(a, b, out, a_shape, b_shape, autob);
+    }
+    else if (is_type<op::Subtract>(binary))
+    {
+        NGRAPH_CHECK(element::from<Tin>() == element::from<Tout>(),
+                     "Input/output types do not match");
+        runtime::reference::subtract<Tin>(a, b, out, a_shape, b_shape, autob);
+    }
+    else if (is_type<op::v1::Subtract>(binary))
+    {
+        NGRAPH_CHECK(element::from<Tin>() == element::from<Tout>(),
+                     "Input/output types do not match");
+        runtime::reference::subtract<Tin>(a, b, out, a_shape, b_shape, autob);
+    }
+    else
+    {
+        NGRAPH_CHECK(false,
+                     "fold_constant_binary must be consistent with is_supported_binary_op");
     }
 }
 
@@ -322,8 +368,8 @@ shared_ptr<op::Constant> fold_constant_binary_arithmetic(shared_ptr<op::Constant
                                                          NodeExecutorTy func)
 {
     const Shape& out_shape = binary->get_shape();
-    runtime::AlignedBuffer buffer(shape_size(out_shape) * sizeof(Tout));
-    Tout* data_ptr = buffer.get_ptr<Tout>();
+    auto buffer = make_shared<runtime::AlignedBuffer>(shape_size(out_shape) * sizeof(Tout));
+    Tout* data_ptr = buffer->get_ptr<Tout>();
 
     // NOTE: We will skip the executor if the shapes do not match, because that means
     // auto-broadcast is in use, and the CPU functors don't yet support that.
@@ -336,206 +382,33 @@ shared_ptr<op::Constant> fold_constant_binary_arithmetic(shared_ptr<op::Constant
         outputs.push_back(data_ptr);
 
         func(inputs, outputs);
-        return make_shared<op::Constant>(binary->get_output_element_type(0), out_shape, data_ptr);
+    }
+    else if (a->get_shape() == b->get_shape())
+    {
+        // Without broadcasting the op is elementwise over the flattened tensors
+        auto evaluate_range = [&](size_t begin, size_t end) {
+            Shape range_shape{end - begin};
+            evaluate_binary_arithmetic<Tin, Tout>(a->get_data_ptr<Tin>() + begin,
+                                                  b->get_data_ptr<Tin>() + begin,
+                                                  data_ptr + begin,
+                                                  range_shape,
+                                                  range_shape,
+                                                  op::AutoBroadcastSpec(),
+                                                  binary);
+        };
+        parallel_for(0, shape_size(out_shape), pass::constant_folding_grain_size, evaluate_range);
     }
     else
     {
-        if (auto add_v0_node = as_type_ptr<op::v0::Add>(binary))
-        {
-            NGRAPH_CHECK(element::from<Tin>() == element::from<Tout>(),
-                         "Input/output types do not match");
-            runtime::reference::add<Tin>(a->get_data_ptr<Tin>(),
-                                         b->get_data_ptr<Tin>(),
-                                         data_ptr,
-                                         a->get_shape(),
-                                         b->get_shape(),
-                                         add_v0_node->get_autob());
-            return make_shared<op::Constant>(
-                binary->get_output_element_type(0), out_shape, data_ptr);
-        }
-        else if (auto add_v1_node = as_type_ptr<op::v1::Add>(binary))
-        {
-            NGRAPH_CHECK(element::from<Tin>() == element::from<Tout>(),
-                         "Input/output types do not match");
-            runtime::reference::add<Tin>(a->get_data_ptr<Tin>(),
-                                         b->get_data_ptr<Tin>(),
-                                         data_ptr,
-                                         a->get_shape(),
-                                         b->get_shape(),
-                                         add_v1_node->get_autob());
-            return make_shared<op::Constant>(
-                binary->get_output_element_type(0), out_shape, data_ptr);
-        }
-        else if (auto divide_v0_node = as_type_ptr<op::v0::Divide>(binary))
-        {
-            NGRAPH_CHECK(element::from<Tin>() == element::from<Tout>(),
-                         "Input/output types do not match");
-            shared_ptr<op::v0::Divide> divop = as_type_ptr<op::v0::Divide>(binary);
-            bool pythondiv = divop->is_pythondiv();
-            runtime::reference::divide<Tin>(a->get_data_ptr<Tin>(),
-                                            b->get_data_ptr<Tin>(),
-                                            data_ptr,
-                                            a->get_shape(),
-                                            b->get_shape(),
-                                            divide_v0_node->get_autob(),
-                                            pythondiv);
-            return make_shared<op::Constant>(
-                binary->get_output_element_type(0), out_shape, data_ptr);
-        }
-        else if (auto divide_v1_node = as_type_ptr<op::v1::Divide>(binary))
-        {
-            NGRAPH_CHECK(element::from<Tin>() == element::from<Tout>(),
-                         "Input/output types do not match");
-            shared_ptr<op::v1::Divide> divop = as_type_ptr<op::v1::Divide>(binary);
-            bool pythondiv = divop->is_pythondiv();
-            runtime::reference::divide<Tin>(a->get_data_ptr<Tin>(),
-                                            b->get_data_ptr<Tin>(),
-                                            data_ptr,
-                                            a->get_shape(),
-                                            b->get_shape(),
-                                            divide_v1_node->get_autob(),
-                                            pythondiv);
-            return make_shared<op::Constant>(
-                binary->get_output_element_type(0), out_shape, data_ptr);
-        }
-        else if (auto maximum_v0_node = as_type_ptr<op::v0::Maximum>(binary))
-        {
-            NGRAPH_CHECK(element::from<Tin>() == element::from<Tout>(),
-                         "Input/output types do not match");
-            runtime::reference::maximum<Tin>(a->get_data_ptr<Tin>(),
-                                             b->get_data_ptr<Tin>(),
-                                             data_ptr,
-                                             a->get_shape(),
-                                             b->get_shape(),
-                                             maximum_v0_node->get_autob());
-            return make_shared<op::Constant>(
-                binary->get_output_element_type(0), out_shape, data_ptr);
-        }
-        else if (auto maximum_v1_node = as_type_ptr<op::v1::Maximum>(binary))
-        {
-            NGRAPH_CHECK(element::from<Tin>() == element::from<Tout>(),
-                         "Input/output types do not match");
-            runtime::reference::maximum<Tin>(a->get_data_ptr<Tin>(),
-                                             b->get_data_ptr<Tin>(),
-                                             data_ptr,
-                                             a->get_shape(),
-                                             b->get_shape(),
-                                             maximum_v1_node->get_autob());
-            return make_shared<op::Constant>(
-                binary->get_output_element_type(0), out_shape, data_ptr);
-        }
-        else if (auto minimum_v0_node = as_type_ptr<op::v0::Minimum>(binary))
-        {
-            NGRAPH_CHECK(element::from<Tin>() == element::from<Tout>(),
-                         "Input/output types do not match");
-            runtime::reference::minimum<Tin>(a->get_data_ptr<Tin>(),
-                                             b->get_data_ptr<Tin>(),
-                                             data_ptr,
-                                             a->get_shape(),
-                                             b->get_shape(),
-                                             minimum_v0_node->get_autob());
-            return make_shared<op::Constant>(
-                binary->get_output_element_type(0), out_shape, data_ptr);
-        }
-        else if (auto minimum_v1_node = as_type_ptr<op::v1::Minimum>(binary))
-        {
-            NGRAPH_CHECK(element::from<Tin>() == element::from<Tout>(),
-                         "Input/output types do not match");
-            runtime::reference::minimum<Tin>(a->get_data_ptr<Tin>(),
-                                             b->get_data_ptr<Tin>(),
-                                             data_ptr,
-                                             a->get_shape(),
-                                             b->get_shape(),
-                                             minimum_v1_node->get_autob());
-            return make_shared<op::Constant>(
-                binary->get_output_element_type(0), out_shape, data_ptr);
-        }
-        else if (auto multiply_v0_node = as_type_ptr<op::v0::Multiply>(binary))
-        {
-            NGRAPH_CHECK(element::from<Tin>() == element::from<Tout>(),
-                         "Input/output types do not match");
-            runtime::reference::multiply<Tin>(a->get_data_ptr<Tin>(),
-                                              b->get_data_ptr<Tin>(),
-                                              data_ptr,
-                                              a->get_shape(),
-                                              b->get_shape(),
-                                              multiply_v0_node->get_autob());
-            return make_shared<op::Constant>(
-                binary->get_output_element_type(0), out_shape, data_ptr);
-        }
-        else if (auto multiply_v1_node = as_type_ptr<op::v1::Multiply>(binary))
-        {
-            NGRAPH_CHECK(element::from<Tin>() == element::from<Tout>(),
-                         "Input/output types do not match");
-            runtime::reference::multiply<Tin>(a->get_data_ptr<Tin>(),
-                                              b->get_data_ptr<Tin>(),
-                                              data_ptr,
-                                              a->get_shape(),
-                                              b->get_shape(),
-                                              multiply_v1_node->get_autob());
-            return make_shared<op::Constant>(
-                binary->get_output_element_type(0), out_shape, data_ptr);
-        }
-        else if (auto power_v0_node = as_type_ptr<op::v0::Power>(binary))
-        {
-            NGRAPH_CHECK(element::from<Tin>() == element::from<Tout>(),
-                         "Input/output types do not match");
-            shared_ptr<op::v0::Power> powop = as_type_ptr<op::v0::Power>(binary);
-            runtime::reference::power<Tin>(a->get_data_ptr<Tin>(),
-                                           b->get_data_ptr<Tin>(),
-                                           data_ptr,
-                                           a->get_shape(),
-                                           b->get_shape(),
-                                           power_v0_node->get_autob());
-            return make_shared<op::Constant>(
-                binary->get_output_element_type(0), out_shape, data_ptr);
-        }
-        else if (auto power_v1_node = as_type_ptr<op::v1::Power>(binary))
-        {
-            NGRAPH_CHECK(element::from<Tin>() == element::from<Tout>(),
-                         "Input/output types do not match");
-            shared_ptr<op::v1::Power> powop = as_type_ptr<op::v1::Power>(binary);
-            runtime::reference::power<Tin>(a->get_data_ptr<Tin>(),
-                                           b->get_data_ptr<Tin>(),
-                                           data_ptr,
-                                           a->get_shape(),
-                                           b->get_shape(),
-                                           power_v1_node->get_autob());
-            return make_shared<op::Constant>(
-                binary->get_output_element_type(0), out_shape, data_ptr);
-        }
-        else if (auto subtract_v0_node = as_type_ptr<op::Subtract>(binary))
-        {
-            NGRAPH_CHECK(element::from<Tin>() == element::from<Tout>(),
-                         "Input/output types do not match");
-            runtime::reference::subtract<Tin>(a->get_data_ptr<Tin>(),
+        evaluate_binary_arithmetic<Tin, Tout>(a->get_data_ptr<Tin>(),
                                               b->get_data_ptr<Tin>(),
                                               data_ptr,
                                               a->get_shape(),
                                               b->get_shape(),
-                                              subtract_v0_node->get_autob());
-            return make_shared<op::Constant>(
-                binary->get_output_element_type(0), out_shape, data_ptr);
-        }
-        else if (auto subtract_v1_node = as_type_ptr<op::v1::Subtract>(binary))
-        {
-            NGRAPH_CHECK(element::from<Tin>() == element::from<Tout>(),
-                         "Input/output types do not match");
-            runtime::reference::subtract<Tin>(a->get_data_ptr<Tin>(),
-                                              b->get_data_ptr<Tin>(),
-                                              data_ptr,
-                                              a->get_shape(),
-                                              b->get_shape(),
-                                              subtract_v1_node->get_autob());
-            return make_shared<op::Constant>(
-                binary->get_output_element_type(0), out_shape, data_ptr);
-        }
-        else
-        {
-            NGRAPH_CHECK(false,
-                         "fold_constant_binary must be consistent with is_supported_binary_op");
-        }
+                                              binary->get_autob(),
+                                              binary);
     }
+    return make_shared<op::Constant>(binary->get_output_element_type(0), out_shape, buffer);
 }
 
 template <class Tin>
@@ -16,20 +16,58 @@
 
 #include "constant_folding.hpp"
 #include "ngraph/op/broadcast.hpp"
+#include "ngraph/parallel.hpp"
 #include "ngraph/runtime/opt_kernel/broadcast.hpp"
 #include "ngraph/type/element_type.hpp"
 
 using namespace std;
 using namespace ngraph;
 
+// Broadcasts into out_shape, split across threads along output axis 0. Input rows only advance
+// with the output rows when axis 0 is not a broadcast axis.
+template <class T>
+static void evaluate_broadcast(const T* in,
+                               T* out,
+                               const Shape& in_shape,
+                               const Shape& out_shape,
+                               const AxisSet& broadcast_axes)
+{
+    if (out_shape.empty() || out_shape[0] < 2)
+    {
+        runtime::opt_kernel::broadcast<T>(in, out, in_shape, out_shape, broadcast_axes);
+        return;
+    }
+
+    bool axis0_broadcast = broadcast_axes.count(0) != 0;
+    size_t in_row_size = axis0_broadcast ? 0 : shape_size(in_shape) / in_shape[0];
+    size_t out_row_size = shape_size(out_shape) / out_shape[0];
+    size_t grain_size =
+        max<size_t>(1, pass::constant_folding_grain_size / max<size_t>(1, out_row_size));
+
+    parallel_for(0, out_shape[0], grain_size, [&](size_t begin, size_t end) {
+        Shape piece_in_shape = in_shape;
+        Shape piece_out_shape = out_shape;
+        if (!axis0_broadcast)
+        {
+            piece_in_shape[0] = end - begin;
+        }
+        piece_out_shape[0] = end - begin;
+        runtime::opt_kernel::broadcast<T>(in + begin * in_row_size,
+                                          out + begin * out_row_size,
+                                          piece_in_shape,
+                                          piece_out_shape,
+                                          broadcast_axes);
+    });
+}
+
 template <class T>
 shared_ptr<op::Constant> fold_constant_broadcast(shared_ptr<op::Constant> constant,
                                                  shared_ptr<Node> broadcast,
                                                  NodeExecutorTy func)
 {
     const Shape& out_shape = broadcast->get_shape();
-    runtime::AlignedBuffer buffer(shape_size(out_shape) * sizeof(T));
-    T* data_ptr = buffer.get_ptr<T>();
+    auto buffer = make_shared<runtime::AlignedBuffer>(shape_size(out_shape) * sizeof(T));
+    T* data_ptr = buffer->get_ptr<T>();
 
     if (func)
     {
@@ -45,11 +83,11 @@ shared_ptr<op::Constant> fold_constant_broadcast(shared_ptr<op::Constant> consta
         auto static_bcast_axes = broadcast_v1->get_broadcast_axes();
         if (static_bcast_axes.first)
         {
-            runtime::opt_kernel::broadcast<T>(constant->get_data_ptr<T>(),
-                                              data_ptr,
-                                              constant->get_shape(),
-                                              out_shape,
-                                              static_bcast_axes.second);
+            evaluate_broadcast<T>(constant->get_data_ptr<T>(),
+                                  data_ptr,
+                                  constant->get_shape(),
+                                  out_shape,
+                                  static_bcast_axes.second);
         }
         else
         {
@@ -58,18 +96,18 @@ shared_ptr<op::Constant> fold_constant_broadcast(shared_ptr<op::Constant> consta
     }
     else if (auto broadcast_v0 = as_type_ptr<op::v0::Broadcast>(broadcast))
     {
-        runtime::opt_kernel::broadcast<T>(constant->get_data_ptr<T>(),
-                                          data_ptr,
-                                          constant->get_shape(),
-                                          out_shape,
-                                          broadcast_v0->get_broadcast_axes());
+        evaluate_broadcast<T>(constant->get_data_ptr<T>(),
+                              data_ptr,
+                              constant->get_shape(),
+                              out_shape,
+                              broadcast_v0->get_broadcast_axes());
     }
     else
     {
         throw ngraph_error("Unsupported op in broadcast constant folding.");
     }
 
-    return make_shared<op::Constant>(constant->get_element_type(), out_shape, data_ptr);
+    return make_shared<op::Constant>(constant->get_element_type(), out_shape, buffer);
 }
 
 void pass::ConstantFolding::construct_constant_broadcast()
@@ -36,14 +36,14 @@ static shared_ptr<op::Constant> fold_constant_concat_helper(const shared_ptr<op:
         arg_shapes.push_back(input.get_shape());
     }
 
-    runtime::AlignedBuffer buffer(shape_size(concat->get_shape()) * sizeof(T));
-    T* data_ptr = buffer.get_ptr<T>();
+    auto buffer = make_shared<runtime::AlignedBuffer>(shape_size(concat->get_shape()) * sizeof(T));
+    T* data_ptr = buffer->get_ptr<T>();
 
     runtime::reference::concat<T>(
         arg_bufs, data_ptr, arg_shapes, concat->get_shape(), concat->get_concatenation_axis());
 
     return make_shared<op::Constant>(
-        concat->get_output_element_type(0), concat->get_output_shape(0), data_ptr);
+        concat->get_output_element_type(0), concat->get_output_shape(0), buffer);
 }
 
 void pass::ConstantFolding::construct_constant_concat()
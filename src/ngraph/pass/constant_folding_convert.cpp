@@ -16,6 +16,7 @@
 
 #include "constant_folding.hpp"
 #include "ngraph/op/convert.hpp"
+#include "ngraph/parallel.hpp"
 #include "ngraph/runtime/reference/convert.hpp"
 
 using namespace std;
@@ -29,13 +30,16 @@ shared_ptr<op::Constant> fold_constant_convert_helper1(shared_ptr<op::Constant>
                                                        const element::Type& output_element_type)
 {
     const Shape& out_shape = constant->get_shape();
-    runtime::AlignedBuffer buffer(shape_size(out_shape) * sizeof(TO));
-    TO* data_ptr = buffer.get_ptr<TO>();
+    auto buffer = make_shared<runtime::AlignedBuffer>(shape_size(out_shape) * sizeof(TO));
+    const TI* in = constant->get_data_ptr<TI>();
+    TO* out = buffer->get_ptr<TO>();
 
-    runtime::reference::convert<TI, TO>(
-        constant->get_vector<TI>().data(), data_ptr, shape_size(out_shape));
+    parallel_for(
+        0, shape_size(out_shape), pass::constant_folding_grain_size, [&](size_t begin, size_t end) {
+            runtime::reference::convert<TI, TO>(in + begin, out + begin, end - begin);
+        });
 
-    return make_shared<op::Constant>(output_element_type, out_shape, data_ptr);
+    return make_shared<op::Constant>(output_element_type, out_shape, buffer);
 }
 
 // Helper for mapping element::Types to runtime::reference::convert, which is templated in C++
@@ -28,8 +28,8 @@ static shared_ptr<op::Constant> fold_constant_gather_helper(const shared_ptr<op:
                                                             const shared_ptr<op::Constant>& indices,
                                                             const shared_ptr<Node>& gather)
 {
-    runtime::AlignedBuffer buffer(shape_size(gather->get_shape()) * sizeof(T));
-    T* data_ptr = buffer.get_ptr<T>();
+    auto buffer = make_shared<runtime::AlignedBuffer>(shape_size(gather->get_shape()) * sizeof(T));
+    T* data_ptr = buffer->get_ptr<T>();
 
     if (auto gather_v1 = as_type_ptr<op::v1::Gather>(gather))
     {
@@ -57,7 +57,7 @@ static shared_ptr<op::Constant> fold_constant_gather_helper(const shared_ptr<op:
     }
 
     return make_shared<op::Constant>(
-        gather->get_output_element_type(0), gather->get_output_shape(0), data_ptr);
+        gather->get_output_element_type(0), gather->get_output_shape(0), buffer);
 }
 
 template <typename T>
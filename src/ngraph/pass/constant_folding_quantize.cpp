@@ -28,19 +28,19 @@ shared_ptr<op::Constant> fold_constant_quantize(shared_ptr<op::Constant> constan
                                                 shared_ptr<op::Constant> offset)
 {
     const Shape& out_shape = constant->get_shape();
-    runtime::AlignedBuffer buffer(shape_size(out_shape) * sizeof(QUANT));
-    QUANT* data_ptr = buffer.get_ptr<QUANT>();
+    auto buffer = make_shared<runtime::AlignedBuffer>(shape_size(out_shape) * sizeof(QUANT));
+    QUANT* data_ptr = buffer->get_ptr<QUANT>();
 
-    runtime::reference::quantize<REAL, QUANT>(constant->get_vector<REAL>().data(),
-                                              scale->get_vector<REAL>().data(),
-                                              offset->get_vector<QUANT>().data(),
+    runtime::reference::quantize<REAL, QUANT>(constant->get_data_ptr<REAL>(),
+                                              scale->get_data_ptr<REAL>(),
+                                              offset->get_data_ptr<QUANT>(),
                                               data_ptr,
                                               constant->get_shape(),
                                               scale->get_shape(),
                                               quant->get_axes(),
                                               quant->get_round_mode());
 
-    return make_shared<op::Constant>(quant->get_element_type(), out_shape, data_ptr);
+    return make_shared<op::Constant>(quant->get_element_type(), out_shape, buffer);
 }
 
 void pass::ConstantFolding::construct_constant_quantize()
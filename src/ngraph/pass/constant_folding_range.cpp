@@ -26,12 +26,12 @@ shared_ptr<op::Constant> fold_constant_range(shared_ptr<op::Constant> start,
                                              shared_ptr<op::Constant> step,
                                              shared_ptr<op::Range> range)
 {
-    runtime::AlignedBuffer buffer(shape_size(range->get_shape()) * sizeof(T));
-    T* data_ptr = buffer.get_ptr<T>();
+    auto buffer = make_shared<runtime::AlignedBuffer>(shape_size(range->get_shape()) * sizeof(T));
+    T* data_ptr = buffer->get_ptr<T>();
     runtime::reference::range<T>(
-        start->get_vector<T>().data(), step->get_vector<T>().data(), range->get_shape(), data_ptr);
+        start->get_data_ptr<T>(), step->get_data_ptr<T>(), range->get_shape(), data_ptr);
 
-    return make_shared<op::Constant>(range->get_element_type(), range->get_shape(), data_ptr);
+    return make_shared<op::Constant>(range->get_element_type(), range->get_shape(), buffer);
 }
 
 void pass::ConstantFolding::construct_constant_range()
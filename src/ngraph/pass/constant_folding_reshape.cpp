@@ -16,19 +16,92 @@
 
 #include "constant_folding.hpp"
 #include "ngraph/op/reshape.hpp"
+#include "ngraph/parallel.hpp"
 #include "ngraph/runtime/opt_kernel/reshape.hpp"
 
 using namespace std;
 using namespace ngraph;
 
+// When the leading axis stays in place the output splits into contiguous row ranges that the
+// threads reorder independently.
+template <class T>
+static void evaluate_reshape(const T* in,
+                             T* out,
+                             const Shape& in_shape,
+                             const AxisVector& input_order,
+                             const Shape& out_shape)
+{
+    if (in_shape.size() < 2 || in_shape.size() > 6 || input_order[0] != 0 || in_shape[0] < 2)
+    {
+        runtime::opt_kernel::reshape<T>(in, out, in_shape, input_order, out_shape);
+        return;
+    }
+
+    size_t row_size = shape_size(in_shape) / in_shape[0];
+    size_t grain_size =
+        max<size_t>(1, pass::constant_folding_grain_size / max<size_t>(1, row_size));
+
+    parallel_for(0, in_shape[0], grain_size, [&](size_t begin, size_t end) {
+        Shape piece_in_shape = in_shape;
+        piece_in_shape[0] = end - begin;
+        Shape piece_out_shape = ngraph::apply_permutation(piece_in_shape, input_order);
+        runtime::opt_kernel::reshape<T>(in + begin * row_size,
+                                        out + begin * row_size,
+                                        piece_in_shape,
+                                        input_order,
+                                        piece_out_shape);
+    });
+}
+
+void pass::reshape_constant_data(const void* in,
+                                 void* out,
+                                 size_t element_size,
+                                 const Shape& in_shape,
+                                 const AxisVector& input_order,
+                                 const Shape& out_shape)
+{
+    switch (element_size)
+    {
+    case 1:
+        evaluate_reshape(static_cast<const uint8_t*>(in),
+                         static_cast<uint8_t*>(out),
+                         in_shape,
+                         input_order,
+                         out_shape);
+        break;
+    case 2:
+        evaluate_reshape(static_cast<const uint16_t*>(in),
+                         static_cast<uint16_t*>(out),
+                         in_shape,
+                         input_order,
+                         out_shape);
+        break;
+    case 4:
+        evaluate_reshape(static_cast<const uint32_t*>(in),
+                         static_cast<uint32_t*>(out),
+                         in_shape,
+                         input_order,
+                         out_shape);
+        break;
+    case 8:
+        evaluate_reshape(static_cast<const uint64_t*>(in),
+                         static_cast<uint64_t*>(out),
+                         in_shape,
+                         input_order,
+                         out_shape);
+        break;
+    default: NGRAPH_CHECK(false, "Unsupported element size ", element_size, " in constant reshape");
+    }
+}
+
 template <class T>
 shared_ptr<op::Constant> fold_constant_reshape(shared_ptr<op::Constant> constant,
                                                shared_ptr<op::Reshape> reshape,
                                                NodeExecutorTy func)
 {
     const Shape& out_shape = reshape->get_shape();
-    runtime::AlignedBuffer buffer(shape_size(out_shape) * sizeof(T));
-    T* data_ptr = buffer.get_ptr<T>();
+    auto buffer = make_shared<runtime::AlignedBuffer>(shape_size(out_shape) * sizeof(T));
+    T* data_ptr = buffer->get_ptr<T>();
 
     if (func != nullptr)
     {
@@ -41,14 +114,15 @@ shared_ptr<op::Constant> fold_constant_reshape(shared_ptr<op::Constant> constant
     }
     else
     {
-        runtime::opt_kernel::reshape<T>(constant->get_data_ptr<T>(),
-                                        data_ptr,
-                                        constant->get_shape(),
-                                        reshape->get_input_order(),
-                                        out_shape);
+        pass::reshape_constant_data(constant->get_data_ptr<T>(),
+                                    data_ptr,
+                                    sizeof(T),
+                                    constant->get_shape(),
+                                    reshape->get_input_order(),
+                                    out_shape);
     }
 
-    return make_shared<op::Constant>(constant->get_element_type(), out_shape, data_ptr);
+    return make_shared<op::Constant>(constant->get_element_type(), out_shape, buffer);
 }
 
 void pass::ConstantFolding::construct_constant_reshape()
@@ -28,8 +28,8 @@ shared_ptr<op::Constant> fold_constant_select(const shared_ptr<op::Constant>& se
                                               const shared_ptr<Node>& select)
 {
     const Shape& out_shape = select->get_shape();
-    runtime::AlignedBuffer buffer(shape_size(out_shape) * sizeof(T));
-    T* data_ptr = buffer.get_ptr<T>();
+    auto buffer = make_shared<runtime::AlignedBuffer>(shape_size(out_shape) * sizeof(T));
+    T* data_ptr = buffer->get_ptr<T>();
 
     if (auto select_v0 = as_type_ptr<op::v0::Select>(select))
     {
@@ -51,7 +51,7 @@ shared_ptr<op::Constant> fold_constant_select(const shared_ptr<op::Constant>& se
                                       select_v1->get_auto_broadcast());
     }
 
-    return make_shared<op::Constant>(select->get_element_type(), out_shape, data_ptr);
+    return make_shared<op::Constant>(select->get_element_type(), out_shape, buffer);
 }
 
 void pass::ConstantFolding::construct_constant_select()
@@ -25,13 +25,13 @@ template <typename T>
 static shared_ptr<op::Constant> fold_constant_tile(const shared_ptr<op::Constant>& data,
                                                    const shared_ptr<Node>& tile)
 {
-    runtime::AlignedBuffer buffer(shape_size(tile->get_shape()) * sizeof(T));
-    T* data_ptr = buffer.get_ptr<T>();
+    auto buffer = make_shared<runtime::AlignedBuffer>(shape_size(tile->get_shape()) * sizeof(T));
+    T* data_ptr = buffer->get_ptr<T>();
     // No need to call the reference kernel.
     if (shape_size(tile->get_shape()) == 0)
     {
         return make_shared<op::Constant>(
-            tile->get_output_element_type(0), tile->get_output_shape(0), data_ptr);
+            tile->get_output_element_type(0), tile->get_output_shape(0), buffer);
     }
 
     if (auto tile_v0 = as_type_ptr<op::v0::Tile>(tile))
@@ -45,7 +45,7 @@ static shared_ptr<op::Constant> fold_constant_tile(const shared_ptr<op::Constant
     }
 
     return make_shared<op::Constant>(
-        tile->get_output_element_type(0), tile->get_output_shape(0), data_ptr);
+        tile->get_output_element_type(0), tile->get_output_shape(0), buffer);
 }
 
 void pass::ConstantFolding::construct_constant_tile()
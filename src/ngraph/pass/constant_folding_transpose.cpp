@@ -16,7 +16,6 @@
 
 #include "constant_folding.hpp"
 #include "ngraph/op/experimental/transpose.hpp"
-#include "ngraph/runtime/opt_kernel/reshape.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -29,15 +28,16 @@ shared_ptr<op::Constant> fold_constant_transpose(shared_ptr<op::Constant> consta
     const Shape& out_shape = transpose->get_shape();
     auto input_order = constant_perm->get_axis_vector_val();
 
-    runtime::AlignedBuffer buffer(shape_size(out_shape) * sizeof(T));
+    auto buffer = make_shared<runtime::AlignedBuffer>(shape_size(out_shape) * sizeof(T));
 
-    runtime::opt_kernel::reshape<T>(constant_data->get_data_ptr<T>(),
-                                    buffer.get_ptr<T>(),
-                                    constant_data->get_shape(),
-                                    input_order,
-                                    out_shape);
+    pass::reshape_constant_data(constant_data->get_data_ptr<T>(),
+                                buffer->get_ptr<T>(),
+                                sizeof(T),
+                                constant_data->get_shape(),
+                                input_order,
+                                out_shape);
 
-    return make_shared<op::Constant>(transpose->get_element_type(), out_shape, buffer.get_ptr<T>());
+    return make_shared<op::Constant>(transpose->get_element_type(), out_shape, buffer);
 }
 
 void pass::ConstantFolding::construct_constant_transpose()
@@ -26,6 +26,7 @@
 #include "ngraph/op/round.hpp"
 #include "ngraph/op/sign.hpp"
 #include "ngraph/op/sqrt.hpp"
+#include "ngraph/parallel.hpp"
 #include "ngraph/runtime/reference/abs.hpp"
 #include "ngraph/runtime/reference/any.hpp"
 #include "ngraph/runtime/reference/ceiling.hpp"
@@ -47,92 +48,93 @@ bool is_supported_unary_op(std::shared_ptr<Node> n)
            is_type<op::Round>(n) || is_type<op::Sign>(n) || is_type<op::Sqrt>(n);
 }
 
+template <class T>
+static void evaluate_unary(const T* in, T* out, size_t count, const shared_ptr<Node>& unary)
+{
+    if (is_type<op::Abs>(unary))
+    {
+        runtime::reference::abs<T>(in, out, count);
+    }
+    else if (is_type<op::Ceiling>(unary))
+    {
+        runtime::reference::ceiling<T>(in, out, count);
+    }
+    else if (is_type<op::Floor>(unary))
+    {
+        runtime::reference::floor<T>(in, out, count);
+    }
+    else if (is_type<op::v1::LogicalNot>(unary))
+    {
+        runtime::reference::logical_not<T>(in, out, count);
+    }
+    else if (is_type<op::Negative>(unary))
+    {
+        runtime::reference::negate<T>(in, out, count);
+    }
+    else if (is_type<op::v0::Not>(unary))
+    {
+        runtime::reference::logical_not<T>(in, out, count);
+    }
+    else if (is_type<op::Relu>(unary))
+    {
+        runtime::reference::relu<T>(in, out, count);
+    }
+    else if (is_type<op::Round>(unary))
+    {
+        runtime::reference::round<T>(in, out, count);
+    }
+    else if (is_type<op::Sign>(unary))
+    {
+        runtime::reference::sign<T>(in, out, count);
+    }
+    else if (is_type<op::Sqrt>(unary))
+    {
+        runtime::reference::sqrt<T>(in, out, count);
+    }
+    else
+    {
+        NGRAPH_CHECK(false, "must be consistent with is_supported_unary_op");
+    }
+}
+
 template <class T>
 shared_ptr<op::Constant> fold_constant_unary(shared_ptr<op::Constant> constant,
                                              shared_ptr<Node> unary,
                                              NodeExecutorTy func)
 {
+    const T* in = constant->get_data_ptr<T>();
+    const Shape& out_shape = unary->get_shape();
+    size_t count = shape_size(out_shape);
+
     // check sqrt arg
     if (is_type<op::Sqrt>(unary))
     {
-        std::vector<T> values{constant->get_vector<T>()};
-        if (std::any_of(values.begin(), values.end(), [](T i) { return i < T(0); }))
+        if (std::any_of(in, in + count, [](T i) { return i < T(0); }))
         {
             throw ngraph_error("Square root of negative value");
         }
     }
 
-    const Shape& out_shape = unary->get_shape();
-    runtime::AlignedBuffer buffer(shape_size(out_shape) * sizeof(T));
+    auto buffer = make_shared<runtime::AlignedBuffer>(count * sizeof(T));
+    T* out = buffer->get_ptr<T>();
 
     if (func != nullptr)
     {
         vector<void*> inputs;
         inputs.push_back(const_cast<void*>(constant->get_data_ptr()));
         vector<void*> outputs;
-        outputs.push_back(buffer.get_ptr<T>());
+        outputs.push_back(out);
 
         func(inputs, outputs);
     }
     else
     {
-        if (is_type<op::Abs>(unary))
-        {
-            runtime::reference::abs<T>(
-                constant->get_data_ptr<T>(), buffer.get_ptr<T>(), shape_size(out_shape));
-        }
-        else if (is_type<op::Ceiling>(unary))
-        {
-            runtime::reference::ceiling<T>(
-                constant->get_data_ptr<T>(), buffer.get_ptr<T>(), shape_size(out_shape));
-        }
-        else if (is_type<op::Floor>(unary))
-        {
-            runtime::reference::floor<T>(
-                constant->get_data_ptr<T>(), buffer.get_ptr<T>(), shape_size(out_shape));
-        }
-        else if (is_type<op::v1::LogicalNot>(unary))
-        {
-            runtime::reference::logical_not<T>(
-                constant->get_data_ptr<T>(), buffer.get_ptr<T>(), shape_size(out_shape));
-        }
-        else if (is_type<op::Negative>(unary))
-        {
-            runtime::reference::negate<T>(
-                constant->get_data_ptr<T>(), buffer.get_ptr<T>(), shape_size(out_shape));
-        }
-        else if (is_type<op::v0::Not>(unary))
-        {
-            runtime::reference::logical_not<T>(
-                constant->get_data_ptr<T>(), buffer.get_ptr<T>(), shape_size(out_shape));
-        }
-        else if (is_type<op::Relu>(unary))
-        {
-            runtime::reference::relu<T>(
-                constant->get_data_ptr<T>(), buffer.get_ptr<T>(), shape_size(out_shape));
-        }
-        else if (is_type<op::Round>(unary))
-        {
-            runtime::reference::round<T>(
-                constant->get_data_ptr<T>(), buffer.get_ptr<T>(), shape_size(out_shape));
-        }
-        else if (is_type<op::Sign>(unary))
-        {
-            runtime::reference::sign<T>(
-                constant->get_data_ptr<T>(), buffer.get_ptr<T>(), shape_size(out_shape));
-        }
-        else if (is_type<op::Sqrt>(unary))
-        {
-            runtime::reference::sqrt<T>(
-                constant->get_data_ptr<T>(), buffer.get_ptr<T>(), shape_size(out_shape));
-        }
-        else
-        {
-            NGRAPH_CHECK(false, "must be consistent with is_supported_unary_op");
-        }
+        parallel_for(0, count, pass::constant_folding_grain_size, [&](size_t begin, size_t end) {
+            evaluate_unary<T>(in + begin, out + begin, end - begin, unary);
+        });
     }
 
-    return make_shared<op::Constant>(constant->get_element_type(), out_shape, buffer.get_ptr<T>());
+    return make_shared<op::Constant>(constant->get_element_type(), out_shape, buffer);
 }
 
 void pass::ConstantFolding::construct_constant_unary()
@@ -14,12 +14,15 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <cstring>
 #include <memory>
 #include <set>
+#include <sstream>
 #include <typeinfo>
 #include <unordered_map>
 
 #include "cse.hpp"
+#include "ngraph/attribute_visitor.hpp"
 #include "ngraph/axis_vector.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/log.hpp"
@@ -138,7 +141,8 @@ static bool cse_binarywise(shared_ptr<Node> a, shared_ptr<Node> b)
 
     return (a->input(0).get_source_output() == b->input(0).get_source_output() &&
             a->input(1).get_source_output() == b->input(1).get_source_output()) ||
-           (a->input(1).get_source_output() == b->input(0).get_source_output() &&
+           (a->is_commutative() &&
+            a->input(1).get_source_output() == b->input(0).get_source_output() &&
             a->input(0).get_source_output() == b->input(1).get_source_output());
 }
 
@@ -210,6 +214,121 @@ static unordered_map<type_index, function<bool(shared_ptr<Node>, shared_ptr<Node
 static unordered_map<type_index, function<bool(shared_ptr<Node>, shared_ptr<Node>)>>
     ops_to_cse_handlers = initialize_ops_to_cse_handlers();
 
+namespace
+{
+    // Writes every attribute a node exposes through visit_attributes into a canonical string, so
+    // that two nodes of the same type have equal signatures exactly when their attributes match.
+    // Attributes that cannot be read back (opaque ValueAccessor<void>) make the node ineligible.
+    class AttributeSignature : public AttributeVisitor
+    {
+    public:
+        AttributeSignature(Node& node) { m_valid = node.visit_attributes(*this) && m_valid; }
+        bool is_valid() const { return m_valid; }
+        string get_signature() const { return m_out.str(); }
+        void on_attribute(const string& name, string& value) override { write(name, value); }
+        void on_attribute(const string& name, bool& value) override
+        {
+            m_out << name << '=' << value << ';';
+        }
+        void on_adapter(const string& name, ValueAccessor<void>& adapter) override
+        {
+            if (auto a = as_type<AttributeAdapter<element::Type>>(&adapter))
+            {
+                m_out << name << '=' << static_cast<element::Type&>(*a) << ';';
+            }
+            else if (auto a = as_type<AttributeAdapter<PartialShape>>(&adapter))
+            {
+                m_out << name << '=' << static_cast<PartialShape&>(*a) << ';';
+            }
+            else
+            {
+                m_valid = false;
+            }
+        }
+        void on_adapter(const string& name, ValueAccessor<string>& adapter) override
+        {
+            write(name, adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<int64_t>& adapter) override
+        {
+            m_out << name << '=' << adapter.get() << ';';
+        }
+        void on_adapter(const string& name, ValueAccessor<double>& adapter) override
+        {
+            // Compare floating point attributes bitwise
+            double value = adapter.get();
+            uint64_t bits;
+            memcpy(&bits, &value, sizeof(bits));
+            m_out << name << '=' << bits << ';';
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<int64_t>>& adapter) override
+        {
+            m_out << name << '=' << adapter.get().size();
+            for (auto value : adapter.get())
+            {
+                m_out << ',' << value;
+            }
+            m_out << ';';
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<float>>& adapter) override
+        {
+            m_out << name << '=' << adapter.get().size();
+            for (auto value : adapter.get())
+            {
+                uint32_t bits;
+                memcpy(&bits, &value, sizeof(bits));
+                m_out << ',' << bits;
+            }
+            m_out << ';';
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<string>>& adapter) override
+        {
+            m_out << name << '=' << adapter.get().size() << ';';
+            for (auto& value : adapter.get())
+            {
+                write(name, value);
+            }
+        }
+
+    private:
+        void write(const string& name, const string& value)
+        {
+            // Length prefix keeps values containing separators unambiguous
+            m_out << name << '=' << value.size() << ':' << value << ';';
+        }
+
+        ostringstream m_out;
+        bool m_valid{true};
+    };
+
+    size_t constant_digest(const op::Constant& constant)
+    {
+        const element::Type& type = constant.get_element_type();
+        size_t size = (shape_size(constant.get_shape()) * type.bitwidth() + 7) / 8;
+        // Uniform constants only compare equal to uniform constants, on their first element
+        if (constant.get_all_data_elements_bitwise_identical())
+        {
+            size = min(size, type.size());
+        }
+        // FNV-1a over 64-bit words, then the trailing bytes
+        const uint64_t prime = 0x100000001b3ULL;
+        uint64_t digest = 0xcbf29ce484222325ULL;
+        const char* data = static_cast<const char*>(constant.get_data_ptr());
+        size_t words = size / sizeof(uint64_t);
+        for (size_t i = 0; i < words; i++)
+        {
+            uint64_t word;
+            memcpy(&word, data + i * sizeof(uint64_t), sizeof(word));
+            digest = (digest ^ word) * prime;
+        }
+        for (size_t i = words * sizeof(uint64_t); i < size; i++)
+        {
+            digest = (digest ^ static_cast<unsigned char>(data[i])) * prime;
+        }
+        return static_cast<size_t>(digest ^ constant.get_all_data_elements_bitwise_identical());
+    }
+}
+
 class NodeKey
 {
 public:
@@ -221,9 +340,44 @@ public:
         , m_ti(TI(m_node_ref))
         , m_backend_handlers(backend_handlers)
     {
+        vector<size_t> hashes{hash<type_index>{}(m_ti)};
+
+        vector<Output<Node>> cargs;
+        for (auto input : m_node->inputs())
+        {
+            cargs.push_back(input.get_source_output());
+        }
+        if (m_node->is_commutative())
+        {
+            sort(begin(cargs), end(cargs));
+        }
+        for (auto arg : cargs)
+        {
+            hashes.push_back(arg.get_node_shared_ptr()->get_instance_id());
+            hashes.push_back(arg.get_index());
+        }
+
+        if (auto constant = as_type_ptr<op::Constant>(m_node))
+        {
+            hashes.push_back(constant_digest(*constant));
+        }
+        else if (ops_to_cse_handlers.count(m_ti) == 0 && m_backend_handlers.count(m_ti) == 0 &&
+                 !m_node->has_state() && m_node->get_control_dependencies().empty())
+        {
+            // No hand-written handler, so fall back on comparing the attributes
+            AttributeSignature signature(m_node_ref);
+            if (signature.is_valid())
+            {
+                m_generic = true;
+                m_signature = signature.get_signature();
+                hashes.push_back(hash<string>{}(m_signature));
+            }
+        }
+        m_hash = hash_combine(hashes);
     }
 
     shared_ptr<Node> get_node() const { return m_node; }
+    size_t get_hash() const { return m_hash; }
     bool operator==(const NodeKey& other) const
     {
         if (m_ti == other.m_ti)
@@ -239,18 +393,59 @@ public:
             {
                 return eh->second(m_node, other.m_node);
             }
+
+            if (m_generic && other.m_generic)
+            {
+                return generic_equal(other);
+            }
         }
 
         return false;
     }
 
 private:
+    bool generic_equal(const NodeKey& other) const
+    {
+        const Node& a = *m_node;
+        const Node& b = *other.m_node;
+        if (m_signature != other.m_signature || a.get_input_size() != b.get_input_size() ||
+            a.get_output_size() != b.get_output_size())
+        {
+            return false;
+        }
+
+        vector<Output<Node>> a_args = a.input_values();
+        vector<Output<Node>> b_args = b.input_values();
+        if (a.is_commutative())
+        {
+            sort(begin(a_args), end(a_args));
+            sort(begin(b_args), end(b_args));
+        }
+        if (a_args != b_args)
+        {
+            return false;
+        }
+
+        for (size_t i = 0; i < a.get_output_size(); i++)
+        {
+            if (a.get_output_element_type(i) != b.get_output_element_type(i) ||
+                !a.get_output_partial_shape(i).same_scheme(b.get_output_partial_shape(i)))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
     shared_ptr<Node> m_node;
     // m_node_ref is only to allow getting the type_index in the ctor
     Node& m_node_ref;
     std::type_index m_ti;
     unordered_map<type_index, function<bool(shared_ptr<Node>, shared_ptr<Node>)>>&
         m_backend_handlers;
+    size_t m_hash;
+    bool m_generic{false};
+    string m_signature;
 };
 
 namespace std
@@ -258,40 +453,7 @@ namespace std
     template <>
     struct hash<NodeKey>
     {
-        size_t operator()(const NodeKey& k) const
-        {
-            Node& p_this = *k.get_node().get();
-            auto ti = TI(p_this);
-
-            hash<type_index> type_hash_compute{};
-            auto type_hash = type_hash_compute(ti);
-
-            vector<size_t> arg_ids;
-
-            arg_ids.push_back(type_hash);
-
-            std::vector<Output<Node>> cargs;
-            for (auto input : k.get_node()->inputs())
-            {
-                cargs.push_back(input.get_source_output());
-            }
-
-            // TODO: Do we need another map, so we could
-            // specify how to compute hash for each op?
-            if (p_this.is_commutative())
-            {
-                sort(begin(cargs), end(cargs));
-            }
-
-            for (auto arg : cargs)
-            {
-                arg_ids.push_back(arg.get_node_shared_ptr()->get_instance_id());
-                arg_ids.push_back(arg.get_index());
-            }
-
-            auto hashc = ngraph::hash_combine(arg_ids);
-            return hashc;
-        }
+        size_t operator()(const NodeKey& k) const { return k.get_hash(); }
     };
 }
 
@@ -302,7 +464,9 @@ bool ngraph::pass::CommonSubexpressionElimination::run_on_function(shared_ptr<ng
 
     for (auto n : f->get_ordered_ops())
     {
-        if (n->is_output() || n->is_parameter())
+        // Control dependencies order a node after others, e.g. a forward op recomputed for
+        // backprop, so it must not be merged with an equal node that lacks them
+        if (n->is_output() || n->is_parameter() || !n->get_control_dependencies().empty())
         {
             continue;
         }
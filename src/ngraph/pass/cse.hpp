@@ -26,6 +26,12 @@ namespace ngraph
     }
 }
 
+/// \brief Replaces nodes that compute the same value as an earlier node with that node.
+///
+/// Two nodes match when they have the same type, the same inputs and the same attributes. Ops
+/// with a built-in or backend handler are compared by that handler, constants by content and all
+/// other ops through visit_attributes. Stateful ops, ops with control dependencies and ops whose
+/// attributes are not fully visitable are never merged by the generic comparison.
 class NGRAPH_API ngraph::pass::CommonSubexpressionElimination : public FunctionPass
 {
 public:
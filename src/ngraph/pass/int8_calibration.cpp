@@ -0,0 +1,274 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/convolution.hpp"
+#include "ngraph/op/dequantize.hpp"
+#include "ngraph/op/dot.hpp"
+#include "ngraph/op/quantize.hpp"
+#include "ngraph/op/quantized_convolution.hpp"
+#include "ngraph/op/quantized_dot.hpp"
+#include "ngraph/op/result.hpp"
+#include "ngraph/pass/int8_calibration.hpp"
+#include "ngraph/runtime/tensor.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static const size_t s_histogram_bins = 2048;
+
+static bool is_quantizable(const shared_ptr<Node>& node)
+{
+    if (!is_type<op::v0::Convolution>(node) && !is_type<op::v0::Dot>(node))
+    {
+        return false;
+    }
+    if (auto dot = as_type_ptr<op::v0::Dot>(node))
+    {
+        if (dot->get_reduction_axes_count() != 1)
+        {
+            return false;
+        }
+    }
+    return node->get_input_element_type(0) == element::f32 &&
+           node->get_input_element_type(1) == element::f32 &&
+           is_type<op::Constant>(node->input_value(1).get_node());
+}
+
+static vector<float> read_floats(const runtime::Tensor& tensor)
+{
+    vector<float> values(shape_size(tensor.get_shape()));
+    tensor.read(values.data(), values.size() * sizeof(float));
+    return values;
+}
+
+static float max_abs(const pass::Int8Calibration::Range& range)
+{
+    return max(fabs(range.min), fabs(range.max));
+}
+
+void pass::Int8Calibration::calibrate(const Function& f, const vector<Output<Node>>& tensors)
+{
+    // Expose every tensor of interest as an extra result of a copy of the function
+    NodeMap node_map;
+    auto clone = clone_function(f, node_map);
+    ResultVector results = clone->get_results();
+    size_t first_probe = results.size();
+    for (auto& tensor : tensors)
+    {
+        auto mapped = node_map.at(tensor.get_node());
+        results.push_back(make_shared<op::Result>(mapped->output(tensor.get_index())));
+    }
+    auto probe = make_shared<Function>(results, clone->get_parameters());
+    auto exec = m_backend->compile(probe);
+
+    vector<shared_ptr<runtime::Tensor>> result_tensors;
+    for (auto& result : results)
+    {
+        result_tensors.push_back(
+            m_backend->create_tensor(result->get_element_type(), result->get_shape()));
+    }
+
+    vector<Range> ranges(tensors.size(),
+                         Range{numeric_limits<float>::max(), numeric_limits<float>::lowest()});
+    for (auto& sample : m_samples)
+    {
+        exec->call_with_validate(result_tensors, sample);
+        for (size_t i = 0; i < tensors.size(); ++i)
+        {
+            for (float value : read_floats(*result_tensors[first_probe + i]))
+            {
+                ranges[i].min = min(ranges[i].min, value);
+                ranges[i].max = max(ranges[i].max, value);
+            }
+        }
+    }
+
+    if (m_method == Method::PERCENTILE)
+    {
+        // Second run: histogram magnitudes over [0, max_abs] and keep the requested percentile;
+        // Quantize and the requantizing kernels saturate the outliers
+        vector<vector<size_t>> histograms(tensors.size(), vector<size_t>(s_histogram_bins, 0));
+        for (auto& sample : m_samples)
+        {
+            exec->call_with_validate(result_tensors, sample);
+            for (size_t i = 0; i < tensors.size(); ++i)
+            {
+                float limit = max_abs(ranges[i]);
+                auto values = read_floats(*result_tensors[first_probe + i]);
+                for (float value : values)
+                {
+                    size_t bin = limit > 0 ? static_cast<size_t>(fabs(value) / limit *
+                                                                 (s_histogram_bins - 1))
+                                           : 0;
+                    histograms[i][bin]++;
+                }
+            }
+        }
+        for (size_t i = 0; i < tensors.size(); ++i)
+        {
+            size_t total = 0;
+            for (size_t n : histograms[i])
+            {
+                total += n;
+            }
+            size_t keep = static_cast<size_t>(ceil(total * m_percentile / 100.0));
+            size_t seen = 0;
+            size_t bin = 0;
+            for (; bin < s_histogram_bins - 1; ++bin)
+            {
+                seen += histograms[i][bin];
+                if (seen >= keep)
+                {
+                    break;
+                }
+            }
+            float clip = max_abs(ranges[i]) * (bin + 1) / (s_histogram_bins - 1);
+            ranges[i].min = max(ranges[i].min, -clip);
+            ranges[i].max = min(ranges[i].max, clip);
+        }
+    }
+
+    for (size_t i = 0; i < tensors.size(); ++i)
+    {
+        m_ranges[tensors[i]] = ranges[i];
+    }
+}
+
+bool pass::Int8Calibration::run_on_function(shared_ptr<Function> f)
+{
+    m_ranges.clear();
+    NodeVector candidates;
+    for (auto& node : f->get_ordered_ops())
+    {
+        if (is_quantizable(node))
+        {
+            candidates.push_back(node);
+        }
+    }
+    if (candidates.empty() || m_samples.empty())
+    {
+        return false;
+    }
+
+    vector<Output<Node>> tensors;
+    for (auto& node : candidates)
+    {
+        tensors.push_back(node->input_value(0));
+        tensors.push_back(node->output(0));
+    }
+    calibrate(*f, tensors);
+
+    // A candidate may consume another candidate's output, which is replaced by a Dequantize
+    // before its consumer is visited, so the ranges are looked up before rewriting anything
+    vector<pair<Range, Range>> candidate_ranges;
+    for (auto& node : candidates)
+    {
+        candidate_ranges.push_back(
+            make_pair(m_ranges.at(node->input_value(0)), m_ranges.at(node->output(0))));
+    }
+
+    bool replaced = false;
+    for (size_t c = 0; c < candidates.size(); ++c)
+    {
+        auto& node = candidates[c];
+        const Range& input_range = candidate_ranges[c].first;
+        float input_max = input_range.max;
+        float output_max = max_abs(candidate_ranges[c].second);
+        auto weights = as_type_ptr<op::Constant>(node->input_value(1).get_node_shared_ptr());
+        vector<float> weight_values = weights->get_vector<float>();
+        float weight_max = 0;
+        for (float value : weight_values)
+        {
+            weight_max = max(weight_max, fabs(value));
+        }
+        if (input_range.min < 0 || input_max <= 0 || output_max <= 0 || weight_max <= 0)
+        {
+            NGRAPH_DEBUG << "Int8Calibration: leaving " << node->get_name() << " in f32";
+            continue;
+        }
+
+        float input_scale = input_max / numeric_limits<uint8_t>::max();
+        float weight_scale = weight_max / numeric_limits<int8_t>::max();
+        float output_scale = output_max / numeric_limits<int8_t>::max();
+
+        vector<int8_t> quantized_weights(weight_values.size());
+        for (size_t i = 0; i < weight_values.size(); ++i)
+        {
+            float q = nearbyint(weight_values[i] / weight_scale);
+            quantized_weights[i] = static_cast<int8_t>(max(-127.0f, min(127.0f, q)));
+        }
+
+        auto input_scale_node = op::Constant::create(element::f32, Shape{}, {input_scale});
+        auto weight_scale_node = op::Constant::create(element::f32, Shape{}, {weight_scale});
+        auto output_scale_node = op::Constant::create(element::f32, Shape{}, {output_scale});
+        auto u8_zero = op::Constant::create(element::u8, Shape{}, {0});
+        auto i8_zero = op::Constant::create(element::i8, Shape{}, {0});
+
+        auto quantized_input =
+            make_shared<op::Quantize>(node->input_value(0),
+                                      input_scale_node,
+                                      u8_zero,
+                                      element::u8,
+                                      AxisSet{},
+                                      op::Quantize::RoundMode::ROUND_NEAREST_TOWARD_EVEN);
+        auto quantized_weights_node =
+            make_shared<op::Constant>(element::i8, weights->get_shape(), quantized_weights);
+
+        shared_ptr<Node> quantized;
+        if (auto conv = as_type_ptr<op::v0::Convolution>(node))
+        {
+            quantized = make_shared<op::QuantizedConvolution>(quantized_input,
+                                                              quantized_weights_node,
+                                                              conv->get_window_movement_strides(),
+                                                              conv->get_window_dilation_strides(),
+                                                              conv->get_padding_below(),
+                                                              conv->get_padding_above(),
+                                                              conv->get_data_dilation_strides(),
+                                                              input_scale_node,
+                                                              u8_zero,
+                                                              weight_scale_node,
+                                                              i8_zero,
+                                                              output_scale_node,
+                                                              i8_zero,
+                                                              element::i8);
+        }
+        else
+        {
+            quantized = make_shared<op::QuantizedDot>(quantized_input,
+                                                      quantized_weights_node,
+                                                      1,
+                                                      input_scale_node,
+                                                      u8_zero,
+                                                      weight_scale_node,
+                                                      i8_zero,
+                                                      output_scale_node,
+                                                      i8_zero,
+                                                      element::i8);
+        }
+        auto dequantized = make_shared<op::Dequantize>(
+            quantized, output_scale_node, i8_zero, element::f32, AxisSet{});
+        replace_node(node, dequantized);
+        replaced = true;
+    }
+    return replaced;
+}
@@ -0,0 +1,96 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "ngraph/pass/pass.hpp"
+#include "ngraph/runtime/backend.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        class Int8Calibration;
+    }
+}
+
+/// \brief Post-training int8 quantization driven by calibration data.
+///
+/// Runs the sample inputs through the function on the given backend, records the range of every
+/// tensor feeding or produced by a Convolution or Dot with constant f32 weights, and rewrites
+/// those ops as
+///
+///     Quantize(u8) -> QuantizedConvolution/QuantizedDot(i8 weights, i8 output) -> Dequantize
+///
+/// The quantized op requantizes its i32 accumulators straight to i8 with the calibrated output
+/// scale. Ops whose input is not known to be non-negative (the quantized kernels take u8 data),
+/// Dots with more than one reduction axis and ops whose ranges are degenerate are left in f32.
+/// MatMul is covered once pass::FusedOpDecomposition has lowered it to Dot.
+///
+/// Scales are per tensor with a zero point of 0; the quantized reference kernels take scalar
+/// scales only.
+class NGRAPH_API ngraph::pass::Int8Calibration : public FunctionPass
+{
+public:
+    enum class Method
+    {
+        /// Scale activations by the largest magnitude seen
+        MIN_MAX,
+        /// Scale activations so that the given percentile of magnitudes is representable and
+        /// saturate the outliers; takes a second run over the samples to build histograms
+        PERCENTILE
+    };
+
+    struct Range
+    {
+        float min;
+        float max;
+    };
+
+    /// \param backend Backend the calibration runs on
+    /// \param samples One vector of input tensors, in parameter order, per calibration run
+    /// \param method How activation ranges are derived from the observed values
+    /// \param percentile Percentile of magnitudes kept by Method::PERCENTILE
+    Int8Calibration(const std::shared_ptr<runtime::Backend>& backend,
+                    const std::vector<std::vector<std::shared_ptr<runtime::Tensor>>>& samples,
+                    Method method = Method::MIN_MAX,
+                    float percentile = 99.99f)
+        : FunctionPass()
+        , m_backend(backend)
+        , m_samples(samples)
+        , m_method(method)
+        , m_percentile(percentile)
+    {
+        set_property(PassProperty::REQUIRE_STATIC_SHAPE, true);
+    }
+
+    bool run_on_function(std::shared_ptr<Function> f) override;
+
+    /// \brief Calibrated ranges of the last run, keyed by the f32 tensors of the quantized ops
+    const std::map<Output<Node>, Range>& get_ranges() const { return m_ranges; }
+private:
+    void calibrate(const Function& f, const std::vector<Output<Node>>& tensors);
+
+    std::shared_ptr<runtime::Backend> m_backend;
+    std::vector<std::vector<std::shared_ptr<runtime::Tensor>>> m_samples;
+    Method m_method;
+    float m_percentile;
+    std::map<Output<Node>, Range> m_ranges;
+};
@@ -19,6 +19,7 @@
 #else
 #include <cxxabi.h>
 #endif
+#include <cstdlib>
 #include <iomanip>
 #include <iostream>
 #include <memory>
@@ -27,6 +28,7 @@
 #include "ngraph/function.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/node.hpp"
+#include "ngraph/parallel.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/pass.hpp"
 #include "ngraph/pass/serialize.hpp"
@@ -36,6 +38,54 @@
 using namespace std;
 using namespace ngraph;
 
+namespace
+{
+    // Makes replace_node and validation report to the profile of a pass while it runs.
+    // Without a profile the current one is kept, so passes that run a nested pass::Manager
+    // are accounted in full.
+    class CurrentPassGuard
+    {
+    public:
+        explicit CurrentPassGuard(pass::PassProfile* profile)
+            : m_profile(profile)
+        {
+            if (m_profile)
+            {
+                m_previous = pass::CompileProfile::set_current_pass(m_profile);
+            }
+        }
+        ~CurrentPassGuard()
+        {
+            if (m_profile)
+            {
+                pass::CompileProfile::set_current_pass(m_previous);
+            }
+        }
+
+    private:
+        pass::PassProfile* m_profile;
+        pass::PassProfile* m_previous = nullptr;
+    };
+}
+
+// Nodes a thread takes at least when a node-local pass runs in parallel
+static const size_t node_pass_grain_size = 1024;
+
+static string get_pass_name(const pass::PassBase& pass)
+{
+    string name = typeid(pass).name();
+#ifndef _WIN32
+    int status;
+    char* demangled = abi::__cxa_demangle(name.c_str(), nullptr, nullptr, &status);
+    if (demangled)
+    {
+        name = demangled;
+        free(demangled);
+    }
+#endif
+    return name;
+}
+
 pass::Manager::Manager()
     : m_visualize(getenv_bool("NGRAPH_ENABLE_VISUALIZE_TRACING"))
     , m_serialize(getenv_bool("NGRAPH_ENABLE_SERIALIZE_TRACING"))
@@ -50,6 +100,11 @@ pass::Manager::~Manager()
 void pass::Manager::run_passes(shared_ptr<Function> func, bool /* transitive */)
 {
     static bool profile_enabled = getenv_bool("NGRAPH_PROFILE_PASS_ENABLE");
+    bool profiling = m_profiling || profile_enabled;
+    if (profiling)
+    {
+        m_profile.clear();
+    }
 
     get_state().set_function(func);
     vector<std::pair<shared_ptr<Function>, bool>> fs{std::make_pair(func, func->is_dynamic())};
@@ -61,6 +116,17 @@ void pass::Manager::run_passes(shared_ptr<Function> func, bool /* transitive */)
     overall_timer.start();
     for (shared_ptr<PassBase> pass : m_pass_list)
     {
+        PassProfile* pass_profile = nullptr;
+        if (profiling)
+        {
+            m_profile.m_pass_profiles.emplace_back();
+            pass_profile = &m_profile.m_pass_profiles.back();
+            pass_profile->name = get_pass_name(*pass);
+            pass_profile->nodes_before = func->get_ops().size();
+            pass_profile->start_microseconds = overall_timer.get_microseconds();
+        }
+        CurrentPassGuard current_pass_guard(pass_profile);
+
         pass_timer.start();
         pass->set_state(get_state());
         auto module_pass = dynamic_pointer_cast<ModulePass>(pass);
@@ -107,9 +173,23 @@ void pass::Manager::run_passes(shared_ptr<Function> func, bool /* transitive */)
                 {
                     continue;
                 }
-                for (shared_ptr<Node> n : f->get_ops())
+                auto ops = f->get_ops();
+                if (node_pass->get_property(PassProperty::NODE_LOCAL))
                 {
-                    node_pass->run_on_node(n);
+                    auto run_range = [&](size_t begin, size_t end) {
+                        for (size_t i = begin; i < end; i++)
+                        {
+                            node_pass->run_on_node(ops[i]);
+                        }
+                    };
+                    parallel_for(0, ops.size(), node_pass_grain_size, run_range);
+                }
+                else
+                {
+                    for (shared_ptr<Node> n : ops)
+                    {
+                        node_pass->run_on_node(n);
+                    }
                 }
             }
         }
@@ -154,17 +234,21 @@ void pass::Manager::run_passes(shared_ptr<Function> func, bool /* transitive */)
         }
         index++;
         pass_timer.stop();
+        if (profiling)
+        {
+            pass_profile->microseconds = pass_timer.get_microseconds();
+            pass_profile->nodes_after = func->get_ops().size();
+        }
         if (profile_enabled)
         {
-            PassBase* p = pass.get();
-            string name = typeid(*p).name();
-#ifndef _WIN32
-            int status;
-            name = abi::__cxa_demangle(name.c_str(), nullptr, nullptr, &status);
-#endif
-            cout << setw(7) << pass_timer.get_milliseconds() << "ms " << name << "\n";
+            cout << setw(7) << pass_timer.get_milliseconds() << "ms " << pass_profile->name
+                 << "\n";
         }
     }
+    if (profiling)
+    {
+        m_profile.m_total_microseconds = overall_timer.get_microseconds();
+    }
     if (profile_enabled)
     {
         cout << "passes done in " << overall_timer.get_milliseconds() << "ms\n";
@@ -24,6 +24,7 @@
 #include "ngraph/pass/manager_state.hpp"
 #include "ngraph/pass/pass.hpp"
 #include "ngraph/pass/pass_config.hpp"
+#include "ngraph/pass/pass_profile.hpp"
 #include "ngraph/pass/validate.hpp"
 
 namespace ngraph
@@ -60,6 +61,11 @@ public:
     void set_pass_visualization(bool new_state) { m_visualize = new_state; }
     void set_pass_serialization(bool new_state) { m_serialize = new_state; }
     void set_per_pass_validation(bool new_state) { m_per_pass_validation = new_state; }
+    /// \brief Enables recording of per-pass statistics by run_passes. Setting
+    ///        NGRAPH_PROFILE_PASS_ENABLE enables it too and also prints the pass timings.
+    void set_profiling(bool new_state) { m_profiling = new_state; }
+    /// \brief Statistics of the last run_passes call made with profiling enabled
+    const CompileProfile& get_profile() const { return m_profile; }
 private:
     template <typename T, class... Args>
     std::shared_ptr<T> push_pass(Args&&... args)
@@ -88,6 +94,8 @@ private:
     std::vector<std::shared_ptr<PassBase>> m_pass_list;
     ManagerState m_state;
     PassConfig m_pass_config;
+    CompileProfile m_profile;
+    bool m_profiling = false;
     bool m_visualize = false;
     bool m_serialize = false;
     bool m_per_pass_validation = true;
@@ -15,9 +15,10 @@
 //*****************************************************************************
 
 #include <exception>
+#include <functional>
 #include <sstream>
+#include <unordered_map>
 
-#include "ngraph/log.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/op/concat.hpp"
 #include "ngraph/op/get_output_element.hpp"
@@ -30,9 +31,12 @@
 using namespace std;
 using namespace ngraph;
 
-pass::MemoryLayout::MemoryLayout(size_t alignment, bool disable_memory_sharing)
+pass::MemoryLayout::MemoryLayout(size_t alignment,
+                                 bool disable_memory_sharing,
+                                 bool plan_in_place_views)
     : m_alignment(alignment)
     , m_disable_memory_sharing(disable_memory_sharing)
+    , m_plan_in_place_views(plan_in_place_views)
 {
     if (m_alignment == 0)
     {
@@ -40,8 +44,185 @@ pass::MemoryLayout::MemoryLayout(size_t alignment, bool disable_memory_sharing)
     }
 }
 
+// Byte offset of the first element of a slice within its input
+static size_t get_slice_offset(const op::Slice* slice)
+{
+    const Shape& in_shape = slice->get_input_shape(0);
+    const Coordinate& lower_bounds = slice->get_lower_bounds();
+    size_t offset = 0;
+    size_t stride = 1;
+    for (size_t i = in_shape.size(); i-- > 0;)
+    {
+        offset += lower_bounds[i] * stride;
+        stride *= in_shape[i];
+    }
+    return offset * slice->get_input_element_type(0).size();
+}
+
+unordered_map<const descriptor::Tensor*, pair<descriptor::Tensor*, size_t>>
+    pass::MemoryLayout::find_in_place_concat_args(shared_ptr<Function> function) const
+{
+    unordered_map<const descriptor::Tensor*, pair<descriptor::Tensor*, size_t>> concat_args;
+    for (shared_ptr<Node> node : function->get_ordered_ops())
+    {
+        auto concat = as_type_ptr<op::Concat>(node);
+        if (!concat || !concat->get_op_annotations() ||
+            concat->get_op_annotations()->get_in_place_oi_pairs().empty())
+        {
+            continue;
+        }
+
+        descriptor::Tensor* output = &concat->output(0).get_tensor();
+        unordered_map<const descriptor::Tensor*, pair<descriptor::Tensor*, size_t>> args;
+        size_t offset = 0;
+        bool in_place = true;
+        for (auto& input : concat->inputs())
+        {
+            auto arg = input.get_source_output().get_node();
+            const descriptor::Tensor* tensor = &input.get_tensor();
+            // Arguments must be intermediates computed by an op that is free to write anywhere,
+            // and each can only be placed once
+            if (arg->is_parameter() || arg->is_constant() || is_type<op::GetOutputElement>(arg) ||
+                concat_args.count(tensor) != 0 || args.count(tensor) != 0 ||
+                offset % m_alignment != 0)
+            {
+                in_place = false;
+                break;
+            }
+            args.insert({tensor, {output, offset}});
+            offset += tensor->size();
+        }
+        if (in_place)
+        {
+            NGRAPH_DEBUG << "Computing arguments of " << concat->get_name() << " in place";
+            concat_args.insert(args.begin(), args.end());
+        }
+    }
+    return concat_args;
+}
+
+void pass::MemoryLayout::plan_in_place_views(shared_ptr<Function> function)
+{
+    MemoryManager mm(m_alignment, m_disable_memory_sharing);
+
+    // Arguments of in-place concats are placed inside the concat's output
+    auto concat_args = find_in_place_concat_args(function);
+
+    // Each tensor maps to the tensor owning the block it lives in. A block is released once no
+    // tensor placed in it is live.
+    unordered_map<const descriptor::Tensor*, const descriptor::Tensor*> owners;
+    unordered_map<const descriptor::Tensor*, size_t> live_counts;
+
+    auto alias = [&](descriptor::Tensor* tensor, const descriptor::Tensor* base, size_t offset) {
+        NGRAPH_DEBUG << "Reusing " << base->get_name() << " for " << tensor->get_name();
+        tensor->set_pool_offset(base->get_pool_offset() + offset);
+        auto owner = owners.at(base);
+        owners[tensor] = owner;
+        live_counts[owner]++;
+    };
+    std::function<void(descriptor::Tensor*)> place = [&](descriptor::Tensor* tensor) {
+        if (owners.count(tensor) != 0)
+        {
+            return;
+        }
+        auto it = concat_args.find(tensor);
+        if (it != concat_args.end())
+        {
+            place(it->second.first);
+            alias(tensor, it->second.first, it->second.second);
+        }
+        else
+        {
+            tensor->set_pool_offset(mm.allocate(tensor->size()));
+            owners[tensor] = tensor;
+            live_counts[tensor] = 1;
+        }
+    };
+
+    for (shared_ptr<Node> node : function->get_ordered_ops())
+    {
+        std::map<const descriptor::Tensor*, std::pair<descriptor::Tensor*, size_t>>
+            in_place_outputs;
+        std::set<const descriptor::Tensor*> reused_inputs;
+
+        if (node->is_op() && !is_type<op::Concat>(node))
+        {
+            auto op = std::static_pointer_cast<op::Op>(node);
+            if (auto op_annotations = op->get_op_annotations())
+            {
+                for (auto oi_pair : op_annotations->get_in_place_oi_pairs())
+                {
+                    auto output = &node->output(oi_pair.output).get_tensor();
+                    auto input = &node->get_input_tensor(oi_pair.input);
+                    // Only intermediates placed in the pool can be shared
+                    if (owners.count(input) == 0 || reused_inputs.count(input) != 0 ||
+                        node->liveness_new_list.count(output) == 0)
+                    {
+                        continue;
+                    }
+
+                    size_t offset = 0;
+                    if (auto slice = as_type_ptr<op::Slice>(node))
+                    {
+                        offset = get_slice_offset(slice.get());
+                        if (offset % m_alignment != 0)
+                        {
+                            continue;
+                        }
+                    }
+
+                    // A destructive kernel overwrites its input, so this must be the last use
+                    // of every tensor sharing the input's memory. Non-destructive kernels pass
+                    // their input through and can always share it.
+                    if (oi_pair.destructive && !is_type<op::GetOutputElement>(node) &&
+                        (node->liveness_free_list.count(input) == 0 ||
+                         live_counts.at(owners.at(input)) != 1))
+                    {
+                        continue;
+                    }
+
+                    in_place_outputs.insert({output, {input, offset}});
+                    if (oi_pair.destructive)
+                    {
+                        reused_inputs.insert(input);
+                    }
+                }
+            }
+        }
+
+        for (descriptor::Tensor* tensor : node->liveness_new_list)
+        {
+            auto it = in_place_outputs.find(tensor);
+            if (it != in_place_outputs.end() && concat_args.count(tensor) == 0)
+            {
+                alias(tensor, it->second.first, it->second.second);
+            }
+            else
+            {
+                place(tensor);
+            }
+        }
+
+        for (const descriptor::Tensor* tensor : node->liveness_free_list)
+        {
+            auto owner = owners.at(tensor);
+            if (--live_counts.at(owner) == 0 && !m_disable_memory_sharing)
+            {
+                mm.free(owner->get_pool_offset());
+            }
+        }
+    }
+    function->set_temporary_pool_size(mm.max_allocated());
+}
+
 bool pass::MemoryLayout::run_on_function(shared_ptr<Function> function)
 {
+    if (m_plan_in_place_views)
+    {
+        plan_in_place_views(function);
+        return false;
+    }
+
     MemoryManager mm(m_alignment, m_disable_memory_sharing);
     for (shared_ptr<Node> node : function->get_ordered_ops())
     {
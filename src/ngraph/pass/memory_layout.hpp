@@ -19,6 +19,8 @@
 #include <limits>
 #include <list>
 #include <sstream>
+#include <unordered_map>
+#include <utility>
 
 #include "ngraph/pass/pass.hpp"
 
@@ -32,15 +34,32 @@ namespace ngraph
     }
 }
 
+/// \brief Assigns pool offsets to the intermediate tensors of a function.
+///
+/// An output with an in-place output-input pair in its op's annotations reuses the input's
+/// memory when this op is the input's last use.
+///
+/// With plan_in_place_views set, the pairs added by pass::MemoryOptimization are planned as
+/// well: destructive outputs reuse an input at its last use, pass-through outputs (including
+/// contiguous Slices) alias their input even while it is live, and the arguments of an
+/// annotated Concat are placed inside the Concat's output. Only backends whose kernels handle
+/// outputs that overlap their inputs may set it.
 class ngraph::pass::MemoryLayout : public FunctionPass
 {
 public:
-    MemoryLayout(size_t alignment = 1, bool disable_memory_sharing = false);
+    MemoryLayout(size_t alignment = 1,
+                 bool disable_memory_sharing = false,
+                 bool plan_in_place_views = false);
     bool run_on_function(std::shared_ptr<ngraph::Function>) override;
 
 private:
+    void plan_in_place_views(std::shared_ptr<ngraph::Function> function);
+    std::unordered_map<const descriptor::Tensor*, std::pair<descriptor::Tensor*, size_t>>
+        find_in_place_concat_args(std::shared_ptr<ngraph::Function> function) const;
+
     size_t m_alignment;
     bool m_disable_memory_sharing;
+    bool m_plan_in_place_views;
 };
 
 class ngraph::pass::MemoryManager
@@ -0,0 +1,139 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "memory_optimization.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/concat.hpp"
+#include "ngraph/op/fused/squeeze.hpp"
+#include "ngraph/op/fused/unsqueeze.hpp"
+#include "ngraph/op/reshape.hpp"
+#include "ngraph/op/slice.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// A slice is contiguous in row-major order when every axis before the first sliced axis has
+// extent one and every axis after it is taken whole
+static bool is_contiguous_slice(const op::Slice* slice)
+{
+    if (is_strided(slice->get_strides()))
+    {
+        return false;
+    }
+    const Shape& in_shape = slice->get_input_shape(0);
+    const Shape& out_shape = slice->get_output_shape(0);
+    size_t axis = 0;
+    while (axis < in_shape.size() && out_shape[axis] == 1)
+    {
+        axis++;
+    }
+    for (size_t i = axis + 1; i < in_shape.size(); i++)
+    {
+        if (in_shape[i] != out_shape[i])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool is_contiguous_concat(const op::Concat* concat)
+{
+    const Shape& shape = concat->get_output_shape(0);
+    for (size_t i = 0; i < static_cast<size_t>(concat->get_concatenation_axis()); i++)
+    {
+        if (shape[i] != 1)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Finds an input that an elementwise op can overwrite with its output. Returns false when there
+// is none, otherwise stores its index in input_index.
+static bool get_overwritable_input(const Node* node, size_t& input_index)
+{
+    for (size_t i = 0; i < node->get_input_size(); i++)
+    {
+        if (node->get_input_element_type(i) == node->get_output_element_type(0) &&
+            node->get_input_shape(i) == node->get_output_shape(0))
+        {
+            input_index = i;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool pass::MemoryOptimization::run_on_function(shared_ptr<Function> function)
+{
+    for (auto& node : function->get_ordered_ops())
+    {
+        if (!node->is_op() || node->get_output_size() != 1 || node->get_input_size() == 0 ||
+            node->get_output_partial_shape(0).is_dynamic())
+        {
+            continue;
+        }
+
+        bool in_place = false;
+        bool destructive = false;
+        size_t input_index = 0;
+        if (node->is_unary_elementwise_arithmetic() || node->is_binary_elementwise_arithmetic())
+        {
+            in_place = get_overwritable_input(node.get(), input_index);
+            destructive = true;
+        }
+        else if (auto reshape = as_type<op::Reshape>(node.get()))
+        {
+            in_place = !reshape->get_is_transpose();
+        }
+        else if (is_type<op::Squeeze>(node) || is_type<op::Unsqueeze>(node))
+        {
+            in_place = true;
+        }
+        else if (auto slice = as_type<op::Slice>(node.get()))
+        {
+            in_place = is_contiguous_slice(slice);
+        }
+        else if (auto concat = as_type<op::Concat>(node.get()))
+        {
+            in_place = is_contiguous_concat(concat);
+        }
+
+        if (!in_place)
+        {
+            continue;
+        }
+
+        auto op = static_pointer_cast<op::Op>(node);
+        auto op_annotations = op->get_op_annotations();
+        if (!op_annotations)
+        {
+            op_annotations = op_annotations_factory();
+            op->set_op_annotations(op_annotations);
+        }
+        else if (op_annotations->get_in_place_oi_pairs().size() > 0)
+        {
+            continue;
+        }
+        NGRAPH_DEBUG << "memory optimization: " << node->get_name() << " output 0 in place of "
+                     << "input " << input_index;
+        op_annotations->add_in_place_oi_pair({0, input_index, destructive});
+    }
+    return false;
+}
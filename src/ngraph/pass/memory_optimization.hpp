@@ -0,0 +1,67 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/op/util/op_annotations.hpp"
+#include "ngraph/pass/pass.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        class MemoryOptimization;
+    }
+}
+
+/// \brief Annotates ops whose outputs can share memory with one of their inputs.
+///
+/// The annotations are in-place output-input pairs in the op's op::util::OpAnnotations and are
+/// honored by pass::MemoryLayout constructed with plan_in_place_views set, which must run after
+/// this pass and pass::Liveness.
+///   - Elementwise arithmetic ops are annotated as destructive; MemoryLayout reuses the input
+///     only when this op is its last use.
+///   - Reshapes that do not transpose, Squeeze and Unsqueeze are annotated as pass-through and
+///     alias their input.
+///   - Slices of a contiguous region are annotated as pass-through and alias the region of their
+///     input.
+///   - Concats along an axis preceded only by dimensions of size 1 are annotated so that their
+///     arguments are computed directly into the output.
+/// Ops that already carry in-place pairs are left untouched.
+class NGRAPH_API ngraph::pass::MemoryOptimization : public FunctionPass
+{
+public:
+    MemoryOptimization()
+        : FunctionPass()
+    {
+    }
+
+    MemoryOptimization(
+        std::function<std::shared_ptr<ngraph::op::util::OpAnnotations>(void)> func)
+        : FunctionPass()
+        , op_annotations_factory(func)
+    {
+    }
+
+    bool run_on_function(std::shared_ptr<ngraph::Function> function) override;
+
+private:
+    std::function<std::shared_ptr<ngraph::op::util::OpAnnotations>(void)> op_annotations_factory =
+        []() -> std::shared_ptr<ngraph::op::util::OpAnnotations> {
+        auto op_annotations = std::make_shared<ngraph::op::util::OpAnnotations>();
+        return op_annotations;
+    };
+};
@@ -53,7 +53,10 @@ namespace ngraph
             // Pass requires node shapes to be static
             REQUIRE_STATIC_SHAPE = 0x1,
             // Pass transformation will change the function's dynamic state
-            CHANGE_DYNAMIC_STATE = 1 << 1
+            CHANGE_DYNAMIC_STATE = 1 << 1,
+            // NodePass only reads and writes the node it runs on, so pass::Manager may run it
+            // on several nodes at once (see set_pass_thread_count)
+            NODE_LOCAL = 1 << 2
         };
     }
 }
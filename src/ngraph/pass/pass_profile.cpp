@@ -0,0 +1,132 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <chrono>
+#include <ostream>
+
+#include "ngraph/pass/pass_profile.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static thread_local pass::PassProfile* s_current_pass = nullptr;
+static thread_local size_t s_validate_depth = 0;
+
+static size_t get_current_microseconds()
+{
+    return chrono::duration_cast<chrono::microseconds>(
+               chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+static string escape_json(const string& s)
+{
+    string result;
+    for (char c : s)
+    {
+        if (c == '"' || c == '\\')
+        {
+            result.push_back('\\');
+        }
+        result.push_back(c);
+    }
+    return result;
+}
+
+static void write_counters(ostream& out, const pass::PassProfile& profile)
+{
+    out << R"("validate_microseconds":)" << profile.validate_microseconds
+        << R"(,"nodes_before":)" << profile.nodes_before << R"(,"nodes_after":)"
+        << profile.nodes_after << R"(,"rewrites":)" << profile.rewrites;
+}
+
+void pass::CompileProfile::clear()
+{
+    m_pass_profiles.clear();
+    m_total_microseconds = 0;
+}
+
+void pass::CompileProfile::write_json(ostream& out) const
+{
+    out << R"({"total_microseconds":)" << m_total_microseconds << R"(,"passes":[)";
+    for (size_t i = 0; i < m_pass_profiles.size(); i++)
+    {
+        const PassProfile& profile = m_pass_profiles[i];
+        out << (i == 0 ? "\n" : ",\n");
+        out << R"({"name":")" << escape_json(profile.name) << R"(","start_microseconds":)"
+            << profile.start_microseconds << R"(,"microseconds":)" << profile.microseconds
+            << ",";
+        write_counters(out, profile);
+        out << "}";
+    }
+    out << "\n]}\n";
+}
+
+void pass::CompileProfile::write_chrome_trace(ostream& out) const
+{
+    out << R"({"traceEvents":[)";
+    for (size_t i = 0; i < m_pass_profiles.size(); i++)
+    {
+        const PassProfile& profile = m_pass_profiles[i];
+        out << (i == 0 ? "\n" : ",\n");
+        out << R"({"name":")" << escape_json(profile.name)
+            << R"(","cat":"pass","ph":"X","pid":0,"tid":0,"ts":)" << profile.start_microseconds
+            << R"(,"dur":)" << profile.microseconds << R"(,"args":{)";
+        write_counters(out, profile);
+        out << "}}";
+    }
+    out << "\n]}\n";
+}
+
+pass::PassProfile* pass::CompileProfile::set_current_pass(PassProfile* profile)
+{
+    PassProfile* previous = s_current_pass;
+    s_current_pass = profile;
+    return previous;
+}
+
+void pass::CompileProfile::record_rewrite()
+{
+    if (s_current_pass)
+    {
+        s_current_pass->rewrites++;
+    }
+}
+
+pass::CompileProfile::ValidateScope::ValidateScope()
+{
+    if (s_current_pass)
+    {
+        m_counted = true;
+        if (s_validate_depth++ == 0)
+        {
+            m_active = true;
+            m_start = get_current_microseconds();
+        }
+    }
+}
+
+pass::CompileProfile::ValidateScope::~ValidateScope()
+{
+    if (m_counted)
+    {
+        s_validate_depth--;
+    }
+    if (m_active && s_current_pass)
+    {
+        s_current_pass->validate_microseconds += get_current_microseconds() - m_start;
+    }
+}
@@ -0,0 +1,97 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+#include "ngraph/ngraph_visibility.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        struct PassProfile;
+        class CompileProfile;
+    }
+}
+
+/// \brief Compile-time statistics of one pass, recorded by pass::Manager::run_passes when
+///        profiling is enabled.
+struct NGRAPH_API ngraph::pass::PassProfile
+{
+    /// \brief Demangled class name of the pass
+    std::string name;
+    /// \brief Start of the pass, relative to the start of run_passes
+    size_t start_microseconds = 0;
+    /// \brief Wall time of the pass
+    size_t microseconds = 0;
+    /// \brief Part of the wall time spent in validate_and_infer_types
+    size_t validate_microseconds = 0;
+    /// \brief Number of nodes in the function before the pass ran
+    size_t nodes_before = 0;
+    /// \brief Number of nodes in the function after the pass ran
+    size_t nodes_after = 0;
+    /// \brief Number of nodes the pass replaced through replace_node
+    size_t rewrites = 0;
+};
+
+/// \brief Per-pass statistics of the last pass::Manager::run_passes call.
+class NGRAPH_API ngraph::pass::CompileProfile
+{
+public:
+    const std::vector<PassProfile>& get_pass_profiles() const { return m_pass_profiles; }
+    /// \brief Wall time of run_passes
+    size_t get_total_microseconds() const { return m_total_microseconds; }
+    void clear();
+
+    /// \brief Writes the profile as a JSON object holding one record per pass.
+    void write_json(std::ostream& out) const;
+    /// \brief Writes the profile in the chrome tracing format, which can be viewed at
+    ///        chrome://tracing/
+    void write_chrome_trace(std::ostream& out) const;
+
+    /// \brief Makes \p profile the record that the hooks below update on the calling thread,
+    ///        or stops recording if \p profile is nullptr.
+    /// \return The record that was current before, to be restored when the pass is done
+    static PassProfile* set_current_pass(PassProfile* profile);
+    /// \brief Called by replace_node
+    static void record_rewrite();
+
+    /// \brief Accounts the time spent in its scope to the validate_microseconds of the
+    ///        current pass. Nested scopes are only accounted once.
+    class NGRAPH_API ValidateScope
+    {
+    public:
+        ValidateScope();
+        ~ValidateScope();
+        ValidateScope(const ValidateScope&) = delete;
+        ValidateScope& operator=(const ValidateScope&) = delete;
+
+    private:
+        size_t m_start = 0;
+        bool m_counted = false;
+        bool m_active = false;
+    };
+
+private:
+    friend class Manager;
+    std::vector<PassProfile> m_pass_profiles;
+    size_t m_total_microseconds = 0;
+};
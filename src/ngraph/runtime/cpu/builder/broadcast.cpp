@@ -17,6 +17,7 @@
 #include <cstring>
 
 #include "ngraph/op/broadcast.hpp"
+#include "ngraph/runtime/cpu/builder/collapse_dims.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
 #include "ngraph/runtime/cpu/kernel/broadcast.hpp"
 
@@ -39,91 +40,11 @@ namespace ngraph
                 auto broadcast = static_cast<const ngraph::op::Broadcast*>(node);
                 auto broadcast_axes = broadcast->get_broadcast_axes();
 
-                auto arg_shape = broadcast->get_argument(0)->get_shape();
                 out_shape = broadcast->get_shape();
 
-                // TODO(jmenon): Shape transformations, rank reduction etc. needs to be general
-                // and not in any one builder.
-
-                // Transform output shape - ex. [4, 1, 2, 2] -> [4, 1, 4]
-                // if we're not broadcasting along axes 2 and 3
-
-                if (broadcast_axes.size() > 1)
-                {
-                    auto innermost_axis = broadcast_axes.end();
-                    advance(innermost_axis, -1);
-                    auto reduced = Shape{};
-                    if (broadcast_axes.size() == (*innermost_axis - *broadcast_axes.begin() + 1))
-                    {
-                        size_t reduced_count = 1;
-                        for (auto axis : broadcast_axes)
-                        {
-                            reduced_count *= out_shape[axis];
-                        }
-
-                        bool done = false;
-                        for (size_t i = 0; i < out_shape.size(); i++)
-                        {
-                            if (!broadcast_axes.count(i))
-                            {
-                                reduced.push_back(out_shape[i]);
-                            }
-                            else
-                            {
-                                if (!done)
-                                {
-                                    reduced.push_back(reduced_count);
-                                    done = true;
-                                }
-                            }
-                        }
-                        broadcast_axes = AxisSet{*broadcast_axes.begin()};
-                        out_shape = reduced;
-                    }
-                }
-
-                // Squeeze output shape
-                // Ex. [2, 1, 1, 2] -> [2, 2]
-
-                auto squeezed_out_shape = Shape{};
-                for (size_t i = 0; i < out_shape.size(); i++)
-                {
-                    if (out_shape[i] != 1)
-                    {
-                        squeezed_out_shape.push_back(out_shape[i]);
-                    }
-                    else
-                    {
-                        broadcast_axes.erase(i);
-                        // TODO(jmenon): This needs to be rewritten
-                        // when it gets moved to the analysis pass
-                        // that doesn't use AxisSet
-                        auto new_bcast_axes = AxisSet{};
-                        for (auto axis : broadcast_axes)
-                        {
-                            if (axis > i)
-                                new_bcast_axes.insert(axis - 1);
-                            else
-                                new_bcast_axes.insert(axis);
-                        }
-                        broadcast_axes = new_bcast_axes;
-                    }
-                }
-                out_shape = squeezed_out_shape;
-
-                // Squeeze input shape
-                auto squeezed_arg_shape = Shape{};
-                for (size_t i = 0; i < arg_shape.size(); i++)
-                {
-                    if (arg_shape[i] != 1)
-                    {
-                        squeezed_arg_shape.push_back(arg_shape[i]);
-                    }
-                }
-                arg_shape = squeezed_arg_shape;
-
-                auto arg_rank = arg_shape.size();
-                auto out_rank = out_shape.size();
+                // Merge runs of broadcast and non-broadcast axes and drop unit axes
+                // Ex. [4, 1, 2, 2] broadcast along {2, 3} -> [4, 4] broadcast along {1}
+                collapse_operated_axes(out_shape, broadcast_axes);
 
                 if (broadcast_axes.empty())
                 {
@@ -131,34 +52,30 @@ namespace ngraph
                     return;
                 }
 
-                if (!arg_rank)
-                {
-                    arg_rank = 1;
-                    arg_shape = Shape{1};
-                }
-
                 // Eigen broadcasts do not reshape their inputs
                 // so expand as needed
                 // Ex. [2] -> [2, 1] for output shape [2, 4]
 
-                expanded_input_shape = Shape(out_rank, 1);
-                size_t i = 0;
-                for (size_t j = 0; j < out_rank; j++)
+                auto out_rank = out_shape.size();
+                expanded_input_shape = out_shape;
+                for (auto axis : broadcast_axes)
                 {
-                    if (broadcast_axes.count(j))
-                    {
-                        expanded_input_shape[j] = 1;
-                    }
-                    else
-                    {
-                        expanded_input_shape[j] = arg_shape[i++];
-                    }
+                    expanded_input_shape[axis] = 1;
                 }
 
-                SELECT_KERNEL_ET_RANK(kernel,
-                                      broadcast->get_input_element_type(0),
-                                      out_rank,
-                                      runtime::cpu::kernel::broadcast)
+                if (out_rank <= 4)
+                {
+                    SELECT_KERNEL_ET_RANK4(kernel,
+                                           broadcast->get_input_element_type(0),
+                                           out_rank,
+                                           runtime::cpu::kernel::broadcast)
+                }
+                else
+                {
+                    SELECT_KERNEL(kernel,
+                                  broadcast->get_input_element_type(0),
+                                  runtime::cpu::kernel::broadcast_ref)
+                }
             }
 
             template <>
@@ -0,0 +1,209 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/runtime/cpu/builder/collapse_dims.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+void runtime::cpu::collapse_operated_axes(Shape& shape, AxisSet& axes)
+{
+    Shape collapsed_shape;
+    AxisSet collapsed_axes;
+    bool previous_operated = false;
+    for (size_t i = 0; i < shape.size(); i++)
+    {
+        if (shape[i] == 1)
+        {
+            continue;
+        }
+        bool operated = axes.count(i) != 0;
+        if (!collapsed_shape.empty() && operated == previous_operated)
+        {
+            collapsed_shape.back() *= shape[i];
+        }
+        else
+        {
+            if (operated)
+            {
+                collapsed_axes.insert(collapsed_shape.size());
+            }
+            collapsed_shape.push_back(shape[i]);
+        }
+        previous_operated = operated;
+    }
+    if (collapsed_shape.empty())
+    {
+        collapsed_shape.push_back(1);
+    }
+    shape = collapsed_shape;
+    axes = collapsed_axes;
+}
+
+void runtime::cpu::collapse_transpose(Shape& shape, AxisVector& order)
+{
+    // Drop unit axes
+    vector<size_t> squeezed_index(shape.size());
+    Shape squeezed_shape;
+    for (size_t i = 0; i < shape.size(); i++)
+    {
+        if (shape[i] != 1)
+        {
+            squeezed_index[i] = squeezed_shape.size();
+            squeezed_shape.push_back(shape[i]);
+        }
+    }
+    AxisVector squeezed_order;
+    for (auto axis : order)
+    {
+        if (shape[axis] != 1)
+        {
+            squeezed_order.push_back(squeezed_index[axis]);
+        }
+    }
+
+    // Input axis i is merged into axis i - 1 if it directly follows it in the output
+    vector<bool> follows_previous(squeezed_shape.size(), false);
+    for (size_t i = 1; i < squeezed_order.size(); i++)
+    {
+        if (squeezed_order[i] == squeezed_order[i - 1] + 1)
+        {
+            follows_previous[squeezed_order[i]] = true;
+        }
+    }
+    vector<size_t> collapsed_index(squeezed_shape.size());
+    Shape collapsed_shape;
+    for (size_t i = 0; i < squeezed_shape.size(); i++)
+    {
+        if (follows_previous[i])
+        {
+            collapsed_index[i] = collapsed_index[i - 1];
+            collapsed_shape.back() *= squeezed_shape[i];
+        }
+        else
+        {
+            collapsed_index[i] = collapsed_shape.size();
+            collapsed_shape.push_back(squeezed_shape[i]);
+        }
+    }
+    AxisVector collapsed_order;
+    for (size_t i = 0; i < squeezed_order.size(); i++)
+    {
+        if (!follows_previous[squeezed_order[i]])
+        {
+            collapsed_order.push_back(collapsed_index[squeezed_order[i]]);
+        }
+    }
+
+    if (collapsed_shape.empty())
+    {
+        collapsed_shape.push_back(1);
+        collapsed_order.push_back(0);
+    }
+    shape = collapsed_shape;
+    order = collapsed_order;
+}
+
+void runtime::cpu::collapse_slice(Shape& arg_shape,
+                                  Shape& out_shape,
+                                  Coordinate& lower_bounds,
+                                  Coordinate& upper_bounds,
+                                  Strides& strides)
+{
+    if (shape_size(out_shape) == 0)
+    {
+        return;
+    }
+
+    Shape collapsed_arg_shape;
+    Shape collapsed_out_shape;
+    Coordinate collapsed_lower_bounds;
+    Coordinate collapsed_upper_bounds;
+    Strides collapsed_strides;
+    for (size_t i = 0; i < arg_shape.size(); i++)
+    {
+        if (arg_shape[i] == 1)
+        {
+            continue;
+        }
+        bool whole = lower_bounds[i] == 0 && upper_bounds[i] == arg_shape[i] && strides[i] == 1;
+        if (whole && !collapsed_strides.empty() && collapsed_strides.back() == 1)
+        {
+            // The preceding axis now steps over contiguous runs of arg_shape[i] elements
+            collapsed_arg_shape.back() *= arg_shape[i];
+            collapsed_out_shape.back() *= arg_shape[i];
+            collapsed_lower_bounds.back() *= arg_shape[i];
+            collapsed_upper_bounds.back() *= arg_shape[i];
+        }
+        else
+        {
+            collapsed_arg_shape.push_back(arg_shape[i]);
+            collapsed_out_shape.push_back(out_shape[i]);
+            collapsed_lower_bounds.push_back(lower_bounds[i]);
+            collapsed_upper_bounds.push_back(upper_bounds[i]);
+            collapsed_strides.push_back(strides[i]);
+        }
+    }
+
+    if (collapsed_arg_shape.empty())
+    {
+        collapsed_arg_shape.push_back(1);
+        collapsed_out_shape.push_back(1);
+        collapsed_lower_bounds.push_back(0);
+        collapsed_upper_bounds.push_back(1);
+        collapsed_strides.push_back(1);
+    }
+    arg_shape = collapsed_arg_shape;
+    out_shape = collapsed_out_shape;
+    lower_bounds = collapsed_lower_bounds;
+    upper_bounds = collapsed_upper_bounds;
+    strides = collapsed_strides;
+}
+
+void runtime::cpu::collapse_concat(vector<Shape>& arg_shapes, Shape& out_shape, size_t& axis)
+{
+    size_t outer = 1;
+    for (size_t i = 0; i < axis; i++)
+    {
+        outer *= out_shape[i];
+    }
+    size_t inner = 1;
+    for (size_t i = axis + 1; i < out_shape.size(); i++)
+    {
+        inner *= out_shape[i];
+    }
+
+    auto collapse = [outer, inner, axis](const Shape& shape) {
+        Shape collapsed_shape;
+        if (outer != 1)
+        {
+            collapsed_shape.push_back(outer);
+        }
+        collapsed_shape.push_back(shape[axis]);
+        if (inner != 1)
+        {
+            collapsed_shape.push_back(inner);
+        }
+        return collapsed_shape;
+    };
+
+    for (auto& arg_shape : arg_shapes)
+    {
+        arg_shape = collapse(arg_shape);
+    }
+    out_shape = collapse(out_shape);
+    axis = (outer != 1 ? 1 : 0);
+}
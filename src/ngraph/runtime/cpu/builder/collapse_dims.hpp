@@ -0,0 +1,70 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <vector>
+
+#include "ngraph/axis_set.hpp"
+#include "ngraph/axis_vector.hpp"
+#include "ngraph/coordinate.hpp"
+#include "ngraph/runtime/cpu/cpu_backend_visibility.h"
+#include "ngraph/shape.hpp"
+#include "ngraph/strides.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            // Kernels are instantiated for every rank they may be called with. The functions
+            // below rewrite the shapes of an operation, at kernel selection time, into an
+            // equivalent form of lower rank by dropping unit axes and merging adjacent axes
+            // that the kernel treats alike. The data layout is unchanged, so the collapsed
+            // shapes can be handed to a kernel in place of the original ones.
+
+            /// \brief Collapses the shape of a broadcast (output shape) or a reduction (input
+            ///        shape) over \p axes. Each run of adjacent operated or non-operated axes
+            ///        becomes a single axis.
+            /// \param shape The shape to collapse; at least one axis is kept.
+            /// \param axes The operated axes, rewritten to index the collapsed shape.
+            CPU_BACKEND_API void collapse_operated_axes(Shape& shape, AxisSet& axes);
+
+            /// \brief Collapses a transpose of \p shape by \p order. Input axes that stay
+            ///        adjacent and in the same order in the output are merged.
+            /// \param shape The input shape to collapse; at least one axis is kept.
+            /// \param order The axis order, rewritten to index the collapsed shape.
+            CPU_BACKEND_API void collapse_transpose(Shape& shape, AxisVector& order);
+
+            /// \brief Collapses a slice of \p arg_shape. An axis that is taken whole with unit
+            ///        stride is merged into the preceding axis if that one has unit stride too.
+            ///        Also suitable for the sliced tensor of ReplaceSlice and UpdateSlice.
+            /// \param arg_shape The shape of the sliced tensor.
+            /// \param out_shape The shape of the slice.
+            CPU_BACKEND_API void collapse_slice(Shape& arg_shape,
+                                                Shape& out_shape,
+                                                Coordinate& lower_bounds,
+                                                Coordinate& upper_bounds,
+                                                Strides& strides);
+
+            /// \brief Collapses a concatenation along \p axis to at most three axes: the axes
+            ///        before \p axis, \p axis itself and the axes after it.
+            CPU_BACKEND_API void
+                collapse_concat(std::vector<Shape>& arg_shapes, Shape& out_shape, size_t& axis);
+        }
+    }
+}
@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 #include "ngraph/op/concat.hpp"
+#include "ngraph/runtime/cpu/builder/collapse_dims.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
 #include "ngraph/runtime/cpu/kernel/concat.hpp"
 #include "ngraph/runtime/cpu/mkldnn_invoke.hpp"
@@ -33,7 +34,7 @@ namespace ngraph
             void Builder::BUILDER_DECL(ngraph::op::Concat)
             {
                 auto concat = static_cast<const ngraph::op::Concat*>(node);
-                auto axis = concat->get_concatenation_axis();
+                size_t axis = concat->get_concatenation_axis();
 
                 auto& functors = external_function->get_functors();
 
@@ -154,10 +155,13 @@ namespace ngraph
                 {
                     std::function<decltype(runtime::cpu::kernel::concat<float, 1>)> kernel;
 
-                    SELECT_KERNEL_ET_RANK(kernel,
-                                          out[0].get_element_type(),
-                                          out[0].get_shape().size(),
-                                          runtime::cpu::kernel::concat)
+                    // At most three axes remain: those before the concatenation axis, the axis
+                    // itself and those after it
+                    collapse_concat(arg_shapes, out_shape, axis);
+                    SELECT_KERNEL_ET_RANK4(kernel,
+                                           out[0].get_element_type(),
+                                           out_shape.size(),
+                                           runtime::cpu::kernel::concat)
 
                     auto functor = [&,
                                     kernel,
@@ -0,0 +1,79 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/elementwise_chain.hpp"
+#include "ngraph/runtime/cpu/op/elementwise_chain.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::ElementwiseChain)
+            {
+                auto& functors = external_function->get_functors();
+                auto chain = static_cast<const ngraph::op::ElementwiseChain*>(node);
+
+                vector<size_t> arg_buffer_indices;
+                vector<bool> boolean_inputs;
+                for (auto& arg : args)
+                {
+                    arg_buffer_indices.push_back(
+                        external_function->get_buffer_index(arg.get_name()));
+                    boolean_inputs.push_back(arg.get_element_type() == element::boolean);
+                }
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                auto element_count = out[0].get_size();
+                auto input_access = chain->get_input_access();
+                auto program = chain->get_program();
+
+                auto functor = [&,
+                                arg_buffer_indices,
+                                boolean_inputs,
+                                input_access,
+                                program,
+                                element_count,
+                                out_buffer_index](CPURuntimeContext* ctx,
+                                                  CPUExecutionContext* /* ectx */) {
+                    vector<void*> inputs;
+                    inputs.reserve(arg_buffer_indices.size());
+                    for (auto index : arg_buffer_indices)
+                    {
+                        inputs.push_back(ctx->buffer_data[index]);
+                    }
+                    runtime::cpu::kernel::elementwise_chain(inputs,
+                                                            boolean_inputs,
+                                                            input_access,
+                                                            program,
+                                                            ctx->buffer_data[out_buffer_index],
+                                                            element_count);
+                };
+                functors.emplace_back(functor);
+            }
+
+            void register_builders_elementwise_chain_cpp()
+            {
+                REGISTER_OP_BUILDER(ElementwiseChain);
+            }
+        }
+    }
+}
@@ -14,6 +14,12 @@
 // limitations under the License.
 //*****************************************************************************
 
+#pragma once
+
+#include "ngraph/runtime/cpu/builder/collapse_dims.hpp"
+
+// The reduction axes are collapsed first, so a reduction over all axes has rank 1 and a reduction
+// over a single axis has rank 3 at most.
 #define BUILD_REDUCTION_FUNCTOR(OP, K)                                                             \
     auto& functors = external_function->get_functors();                                            \
                                                                                                    \
@@ -30,6 +36,17 @@
                                                                                                    \
     auto reduction_axes = op->get_reduction_axes();                                                \
                                                                                                    \
+    collapse_operated_axes(arg_shape, reduction_axes);                                             \
+    arg_rank = arg_shape.size();                                                                   \
+    result_shape.clear();                                                                          \
+    for (size_t i = 0; i < arg_rank; i++)                                                          \
+    {                                                                                              \
+        if (!reduction_axes.count(i))                                                              \
+        {                                                                                          \
+            result_shape.push_back(arg_shape[i]);                                                  \
+        }                                                                                          \
+    }                                                                                              \
+                                                                                                   \
     if (reduction_axes.empty())                                                                    \
     {                                                                                              \
         size_t size = out[0].get_size() * out[0].get_element_type().size();                        \
@@ -44,7 +61,7 @@
     if (reduction_axes.size() == arg_rank && is_optimized_et(args[0].get_element_type()))          \
     {                                                                                              \
         std::function<decltype(runtime::cpu::kernel::reduce_##K##_all<float, 2>)> kernel;          \
-        SELECT_ETS_AND_RANK7(                                                                      \
+        SELECT_ETS_AND_RANK4(                                                                      \
             kernel, result_element_type, arg_rank, runtime::cpu::kernel::reduce_##K##_all);        \
         auto functor = [&, kernel, arg_shape, result_shape, arg_buffer_index, out_buffer_index](   \
             CPURuntimeContext* ctx, CPUExecutionContext* ectx) {                                   \
@@ -64,7 +81,7 @@
         {                                                                                          \
             std::function<decltype(runtime::cpu::kernel::reduce_##K##_innermost_1rd<float, 2>)>    \
                 kernel;                                                                            \
-            SELECT_ETS_AND_RANK7(kernel,                                                           \
+            SELECT_ETS_AND_RANK4(kernel,                                                           \
                                  result_element_type,                                              \
                                  arg_rank,                                                         \
                                  runtime::cpu::kernel::reduce_##K##_innermost_1rd);                \
@@ -82,7 +99,7 @@
         }                                                                                          \
                                                                                                    \
         std::function<decltype(runtime::cpu::kernel::reduce_##K##_1rd<float, 2>)> kernel;          \
-        SELECT_ETS_AND_RANK7(                                                                      \
+        SELECT_ETS_AND_RANK4(                                                                      \
             kernel, result_element_type, arg_rank, runtime::cpu::kernel::reduce_##K##_1rd);        \
         auto functor = [&,                                                                         \
                         kernel,                                                                    \
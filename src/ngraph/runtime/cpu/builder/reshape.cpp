@@ -17,6 +17,7 @@
 #include <cstring>
 
 #include "ngraph/op/reshape.hpp"
+#include "ngraph/runtime/cpu/builder/collapse_dims.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
 #include "ngraph/runtime/cpu/kernel/reshape.hpp"
 #include "ngraph/runtime/cpu/mkldnn_invoke.hpp"
@@ -33,7 +34,7 @@ namespace ngraph
         {
             static void get_reshape_kernel(
                 const ngraph::Node* node,
-                std::function<decltype(runtime::cpu::kernel::reshape_1d<float, 2>)>& kernel,
+                std::function<decltype(runtime::cpu::kernel::transpose<float, 2>)>& kernel,
                 std::function<decltype(runtime::cpu::kernel::reshape_ref<float>)>& ref_kernel,
                 Shape& arg_shape,
                 Shape& result_shape,
@@ -44,10 +45,7 @@ namespace ngraph
                 auto reshape = static_cast<const ngraph::op::Reshape*>(node);
 
                 arg_shape = reshape->get_argument(0)->get_shape();
-                auto arg_rank = arg_shape.size();
-
                 result_shape = reshape->get_output_shape(0);
-                auto result_rank = result_shape.size();
                 auto& result_element_type = reshape->get_element_type();
 
                 input_order = reshape->get_input_order();
@@ -81,25 +79,25 @@ namespace ngraph
                     return;
                 }
 
-                if (arg_rank == 1 && is_optimized_et(result_element_type))
-                {
-                    SELECT_ETS_AND_RANK7(
-                        kernel, result_element_type, result_rank, runtime::cpu::kernel::reshape_1d);
-                }
-                else if (arg_rank == 2 && is_optimized_et(result_element_type))
+                // Only the transpose needs a kernel; the result has the same layout as the
+                // transposed argument. Collapse it so that few ranks need an instantiation.
+                collapse_transpose(arg_shape, input_order);
+                if (is_sorted(input_order.begin(), input_order.end()))
                 {
-                    SELECT_ETS_AND_RANK7(
-                        kernel, result_element_type, result_rank, runtime::cpu::kernel::reshape_2d);
+                    return;
                 }
-                else if (arg_rank == 3 && is_optimized_et(result_element_type))
+                result_shape.clear();
+                for (auto axis : input_order)
                 {
-                    SELECT_ETS_AND_RANK7(
-                        kernel, result_element_type, result_rank, runtime::cpu::kernel::reshape_3d);
+                    result_shape.push_back(arg_shape[axis]);
                 }
-                else if (arg_rank == 4 && is_optimized_et(result_element_type))
+
+                if (arg_shape.size() <= 4 && is_optimized_et(result_element_type))
                 {
-                    SELECT_ETS_AND_RANK7(
-                        kernel, result_element_type, result_rank, runtime::cpu::kernel::reshape_4d);
+                    SELECT_ETS_AND_RANK4(kernel,
+                                         result_element_type,
+                                         arg_shape.size(),
+                                         runtime::cpu::kernel::transpose);
                 }
                 else
                 {
@@ -111,7 +109,7 @@ namespace ngraph
             template <>
             NodeExecutorTy Builder::BUILDER_CF_DECL(ngraph::op::Reshape)
             {
-                std::function<decltype(runtime::cpu::kernel::reshape_1d<float, 2>)> kernel;
+                std::function<decltype(runtime::cpu::kernel::transpose<float, 2>)> kernel;
                 std::function<decltype(runtime::cpu::kernel::reshape_ref<float>)> ref_kernel;
                 Shape arg_shape, result_shape;
                 AxisVector input_order;
@@ -169,7 +167,7 @@ namespace ngraph
                 auto arg_buffer_index = external_function->get_buffer_index(args[0].get_name());
                 auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
 
-                std::function<decltype(runtime::cpu::kernel::reshape_1d<float, 2>)> kernel;
+                std::function<decltype(runtime::cpu::kernel::transpose<float, 2>)> kernel;
                 std::function<decltype(runtime::cpu::kernel::reshape_ref<float>)> ref_kernel;
                 Shape arg_shape, result_shape;
                 AxisVector input_order;
@@ -17,6 +17,7 @@
 #include <cstring>
 
 #include "ngraph/op/slice.hpp"
+#include "ngraph/runtime/cpu/builder/collapse_dims.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
 #include "ngraph/runtime/cpu/kernel/slice.hpp"
 #include "ngraph/runtime/cpu/mkldnn_invoke.hpp"
@@ -138,12 +139,17 @@ namespace ngraph
                 }
                 else
                 {
-                    if (is_strided(strides) && is_optimized_et(args[0].get_element_type()))
+                    // Merge axes that are taken whole into the preceding axis and drop unit axes
+                    collapse_slice(arg_shape, out_shape, lower_bounds, upper_bounds, strides);
+                    bool use_optimized_kernel =
+                        arg_shape.size() <= 4 && is_optimized_et(args[0].get_element_type());
+
+                    if (is_strided(strides) && use_optimized_kernel)
                     {
                         std::function<decltype(runtime::cpu::kernel::strided_slice<float, 2>)>
                             kernel;
 
-                        SELECT_ETS_AND_RANK7(kernel,
+                        SELECT_ETS_AND_RANK4(kernel,
                                              args[0].get_element_type(),
                                              arg_shape.size(),
                                              runtime::cpu::kernel::strided_slice);
@@ -169,11 +175,11 @@ namespace ngraph
                         };
                         functors.emplace_back(functor);
                     }
-                    else if (is_optimized_et(args[0].get_element_type()))
+                    else if (use_optimized_kernel)
                     {
                         std::function<decltype(runtime::cpu::kernel::slice<float, 2>)> kernel;
 
-                        SELECT_ETS_AND_RANK7(kernel,
+                        SELECT_ETS_AND_RANK4(kernel,
                                              args[0].get_element_type(),
                                              arg_shape.size(),
                                              runtime::cpu::kernel::slice);
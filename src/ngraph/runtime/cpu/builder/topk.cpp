@@ -18,7 +18,7 @@
 
 #include "ngraph/op/topk.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
-#include "ngraph/runtime/reference/topk.hpp"
+#include "ngraph/runtime/cpu/kernel/topk.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -70,7 +70,7 @@ namespace ngraph
                                    out_indices_buffer_index,
                                    out_values_buffer_index](CPURuntimeContext* ctx,
                                                             CPUExecutionContext* /* ectx */) {
-                            ngraph::runtime::reference::topk<float, int64_t>(
+                            ngraph::runtime::cpu::kernel::topk<float, int64_t>(
                                 static_cast<float*>(ctx->buffer_data[arg_buffer_index]),
                                 static_cast<int64_t*>(ctx->buffer_data[out_indices_buffer_index]),
                                 static_cast<float*>(ctx->buffer_data[out_values_buffer_index]),
@@ -95,7 +95,7 @@ namespace ngraph
                                    out_indices_buffer_index,
                                    out_values_buffer_index](CPURuntimeContext* ctx,
                                                             CPUExecutionContext* /* ectx */) {
-                            ngraph::runtime::reference::topk<float, int32_t>(
+                            ngraph::runtime::cpu::kernel::topk<float, int32_t>(
                                 static_cast<float*>(ctx->buffer_data[arg_buffer_index]),
                                 static_cast<int32_t*>(ctx->buffer_data[out_indices_buffer_index]),
                                 static_cast<float*>(ctx->buffer_data[out_values_buffer_index]),
@@ -123,7 +123,7 @@ namespace ngraph
                                    out_indices_buffer_index,
                                    out_values_buffer_index](CPURuntimeContext* ctx,
                                                             CPUExecutionContext* /* ectx */) {
-                            ngraph::runtime::reference::topk<double, int64_t>(
+                            ngraph::runtime::cpu::kernel::topk<double, int64_t>(
                                 static_cast<double*>(ctx->buffer_data[arg_buffer_index]),
                                 static_cast<int64_t*>(ctx->buffer_data[out_indices_buffer_index]),
                                 static_cast<double*>(ctx->buffer_data[out_values_buffer_index]),
@@ -148,7 +148,7 @@ namespace ngraph
                                    out_indices_buffer_index,
                                    out_values_buffer_index](CPURuntimeContext* ctx,
                                                             CPUExecutionContext* /* ectx */) {
-                            ngraph::runtime::reference::topk<double, int32_t>(
+                            ngraph::runtime::cpu::kernel::topk<double, int32_t>(
                                 static_cast<double*>(ctx->buffer_data[arg_buffer_index]),
                                 static_cast<int32_t*>(ctx->buffer_data[out_indices_buffer_index]),
                                 static_cast<double*>(ctx->buffer_data[out_values_buffer_index]),
@@ -176,7 +176,7 @@ namespace ngraph
                                    out_indices_buffer_index,
                                    out_values_buffer_index](CPURuntimeContext* ctx,
                                                             CPUExecutionContext* /* ectx */) {
-                            ngraph::runtime::reference::topk<int32_t, int64_t>(
+                            ngraph::runtime::cpu::kernel::topk<int32_t, int64_t>(
                                 static_cast<int32_t*>(ctx->buffer_data[arg_buffer_index]),
                                 static_cast<int64_t*>(ctx->buffer_data[out_indices_buffer_index]),
                                 static_cast<int32_t*>(ctx->buffer_data[out_values_buffer_index]),
@@ -201,7 +201,7 @@ namespace ngraph
                                    out_indices_buffer_index,
                                    out_values_buffer_index](CPURuntimeContext* ctx,
                                                             CPUExecutionContext* /* ectx */) {
-                            ngraph::runtime::reference::topk<int32_t, int32_t>(
+                            ngraph::runtime::cpu::kernel::topk<int32_t, int32_t>(
                                 static_cast<int32_t*>(ctx->buffer_data[arg_buffer_index]),
                                 static_cast<int32_t*>(ctx->buffer_data[out_indices_buffer_index]),
                                 static_cast<int32_t*>(ctx->buffer_data[out_values_buffer_index]),
@@ -38,6 +38,7 @@ namespace ngraph
             void register_builders_cumsum_cpp();
             void register_builders_dot_cpp();
             void register_builders_dropout_cpp();
+            void register_builders_elementwise_chain_cpp();
             void register_builders_embedding_lookup_cpp();
             void register_builders_erf_cpp();
             void register_builders_gather_cpp();
@@ -74,6 +75,7 @@ namespace ngraph
             void register_builders_slice_cpp();
             void register_builders_softmax_cpp();
             void register_builders_sum_cpp();
+            void register_builders_tensor_iterator_cpp();
             void register_builders_tile_cpp();
             void register_builders_topk_cpp();
             void register_builders_update_slice_cpp();
@@ -15,19 +15,55 @@
 //*****************************************************************************
 
 #include <algorithm>
+#include <cstring>
 #include <thread>
 
 #include "ngraph/env_util.hpp"
+#include "ngraph/log.hpp"
 #include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/runtime/cpu/cpu_call_frame.hpp"
 #include "ngraph/runtime/cpu/cpu_external_function.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor.hpp"
 #include "ngraph/runtime/cpu/cpu_tracing.hpp"
 #include "ngraph/runtime/cpu/mkldnn_emitter.hpp"
+#include "ngraph/runtime/cpu/mkldnn_primitive_cache.hpp"
 
 using namespace std;
 using namespace ngraph;
 
+// FNV-1a style digest over 64-bit words, folded over four independent lanes so that the
+// multiply latency does not serialize the loop. Used to detect changed inputs between calls.
+static uint64_t content_digest(const void* data, size_t size)
+{
+    const uint64_t prime = 0x100000001b3ULL;
+    uint64_t lanes[4] = {0xcbf29ce484222325ULL ^ size,
+                         0x84222325cbf29ce4ULL,
+                         0x9e3779b97f4a7c15ULL,
+                         0xc2b2ae3d27d4eb4fULL};
+    const uint8_t* p = static_cast<const uint8_t*>(data);
+    const size_t block = 4 * sizeof(uint64_t);
+    size_t i = 0;
+    for (; i + block <= size; i += block)
+    {
+        uint64_t w[4];
+        memcpy(w, p + i, block);
+        lanes[0] = (lanes[0] ^ w[0]) * prime;
+        lanes[1] = (lanes[1] ^ w[1]) * prime;
+        lanes[2] = (lanes[2] ^ w[2]) * prime;
+        lanes[3] = (lanes[3] ^ w[3]) * prime;
+    }
+    for (; i < size; i++)
+    {
+        lanes[0] = (lanes[0] ^ p[i]) * prime;
+    }
+    uint64_t digest = lanes[0];
+    for (size_t lane = 1; lane < 4; lane++)
+    {
+        digest = (digest ^ (lanes[lane] + (digest << 6) + (digest >> 2))) * prime;
+    }
+    return digest;
+}
+
 runtime::cpu::CPU_CallFrame::CPU_CallFrame(std::shared_ptr<CPU_ExternalFunction> external_function,
                                            InitContextFuncCG compiled_init_ctx_func,
                                            DestroyContextFuncCG compiled_destroy_ctx_func,
@@ -38,6 +74,7 @@ runtime::cpu::CPU_CallFrame::CPU_CallFrame(std::shared_ptr<CPU_ExternalFunction>
     , m_compiled_destroy_ctx_func(compiled_destroy_ctx_func)
     , m_compiled_function(compiled_function)
 {
+    m_incremental_execution = getenv_bool("NGRAPH_CPU_INCREMENTAL_EXECUTION");
     const auto envConcurrency = getenv_int("NGRAPH_CPU_CONCURRENCY");
     m_num_ctx = envConcurrency <= 0 ? 1 : envConcurrency;
     if (m_num_ctx > std::thread::hardware_concurrency())
@@ -75,12 +112,44 @@ void runtime::cpu::CPU_CallFrame::inner_call(
 {
     vector<void*> inputs;
     vector<void*> outputs;
+    size_t changed_inputs = 0;
+
+    // Snapshots are kept per context since each context holds its own intermediates. The direct
+    // execution executor copies the stale flags into per-tensor flags owned by the external
+    // function, which all contexts share, so with several contexts it has to recompute everything.
+    bool incremental = m_incremental_execution &&
+                       (m_num_ctx == 1 || !m_external_function->is_direct_execution());
+    auto& snapshots = m_input_snapshots[id];
+    bool have_snapshots = snapshots.size() == input_tvs.size();
+    if (incremental && !have_snapshots)
+    {
+        snapshots.assign(input_tvs.size(), InputSnapshot());
+    }
 
     for (size_t i = 0; i < input_tvs.size(); i++)
     {
         shared_ptr<runtime::cpu::CPUTensor> tv =
             static_pointer_cast<runtime::cpu::CPUTensor>(input_tvs[i]);
-        if (disable_caching)
+        if (incremental)
+        {
+            const char* data = tv->get_data_ptr();
+            size_t size = tv->get_size_in_bytes();
+            auto digest = content_digest(data, size);
+            auto& snapshot = snapshots[i];
+            // A matching digest is confirmed against the saved content, so a collision cannot
+            // make an op reuse a stale result
+            bool changed = !have_snapshots || digest != snapshot.digest ||
+                           snapshot.content.size() != size ||
+                           memcmp(snapshot.content.data(), data, size) != 0;
+            m_ctx_vec[id]->p_en[i] = changed;
+            if (changed)
+            {
+                snapshot.digest = digest;
+                snapshot.content.assign(data, data + size);
+                changed_inputs++;
+            }
+        }
+        else if (disable_caching)
         {
             m_ctx_vec[id]->p_en[i] = true;
         }
@@ -98,6 +167,10 @@ void runtime::cpu::CPU_CallFrame::inner_call(
         outputs.push_back(tv->get_data_ptr());
     }
 
+    m_ctx_vec[id]->collect_op_counts = incremental;
+    m_ctx_vec[id]->executed_ops = 0;
+    m_ctx_vec[id]->skipped_ops = 0;
+
     // Invoke compiled computation
     if (!m_external_function->is_direct_execution())
     {
@@ -108,6 +181,16 @@ void runtime::cpu::CPU_CallFrame::inner_call(
         m_external_function->get_executor()(m_ctx_vec[id], inputs, outputs);
     }
 
+    if (incremental)
+    {
+        std::lock_guard<std::mutex> guard(m_mutex);
+        m_incremental_stats.calls++;
+        m_incremental_stats.changed_inputs += changed_inputs;
+        m_incremental_stats.unchanged_inputs += input_tvs.size() - changed_inputs;
+        m_incremental_stats.executed_ops += m_ctx_vec[id]->executed_ops;
+        m_incremental_stats.skipped_ops += m_ctx_vec[id]->skipped_ops;
+    }
+
     if (runtime::cpu::IsTracingEnabled())
     {
         GenerateTimeline(m_external_function->get_op_attrs(),
@@ -160,6 +243,65 @@ void runtime::cpu::CPU_CallFrame::call(
     m_cv.notify_one();
 }
 
+void runtime::cpu::CPU_CallFrame::warm_up(
+    const std::vector<std::shared_ptr<runtime::Tensor>>& output_tvs,
+    const std::vector<std::shared_ptr<runtime::Tensor>>& input_tvs)
+{
+    propagate_layouts(output_tvs, m_external_function->get_result_layout_descriptors());
+    for (size_t id = 0; id < m_num_ctx; id++)
+    {
+        if (m_ctx_vec[id]->first_iteration)
+        {
+            m_ctx_vec[id]->pc = 0;
+            try
+            {
+                inner_call(output_tvs, input_tvs, id, true);
+            }
+            catch (const std::exception& e)
+            {
+                // The context is still in its first iteration, so the setup is redone by the
+                // first real call
+                NGRAPH_WARN << "CPU warm-up failed, deferring setup to the first call: "
+                            << e.what();
+                break;
+            }
+        }
+    }
+
+    // Intermediates now hold warm-up results, so the next call on any context must not
+    // trust staleness hints or input snapshots
+    std::lock_guard<std::mutex> guard(m_mutex);
+    m_prev_ctx = m_num_ctx;
+    for (auto& snapshots : m_input_snapshots)
+    {
+        snapshots.clear();
+    }
+    m_incremental_stats = IncrementalExecutionStats();
+}
+
+void runtime::cpu::CPU_CallFrame::set_incremental_execution(bool enable)
+{
+    std::lock_guard<std::mutex> guard(m_mutex);
+    m_incremental_execution = enable;
+    for (auto& snapshots : m_input_snapshots)
+    {
+        snapshots.clear();
+    }
+}
+
+runtime::cpu::IncrementalExecutionStats
+    runtime::cpu::CPU_CallFrame::get_incremental_execution_stats()
+{
+    std::lock_guard<std::mutex> guard(m_mutex);
+    return m_incremental_stats;
+}
+
+void runtime::cpu::CPU_CallFrame::reset_incremental_execution_stats()
+{
+    std::lock_guard<std::mutex> guard(m_mutex);
+    m_incremental_stats = IncrementalExecutionStats();
+}
+
 void runtime::cpu::CPU_CallFrame::propagate_layouts(
     const std::vector<std::shared_ptr<runtime::Tensor>>& tvs,
     const LayoutDescriptorPtrs& layouts) const
@@ -189,6 +331,9 @@ void runtime::cpu::CPU_CallFrame::setup_runtime_context(Allocator* allocator)
         m_ctx_vec.push_back(ctx);
 
         ctx->pc = 0;
+        ctx->collect_op_counts = false;
+        ctx->executed_ops = 0;
+        ctx->skipped_ops = 0;
         ctx->op_durations = nullptr;
         if (runtime::cpu::IsTracingEnabled())
         {
@@ -247,6 +392,7 @@ void runtime::cpu::CPU_CallFrame::setup_runtime_context(Allocator* allocator)
         }
 #endif
     }
+    m_input_snapshots.resize(m_num_ctx);
     m_num_ctx_available = m_num_ctx;
 }
 
@@ -261,6 +407,13 @@ void runtime::cpu::CPU_CallFrame::cleanup_runtime_context()
         delete[] ctx->p_en;
         for (auto p : ctx->mkldnn_primitives)
         {
+#if MKLDNN_VERSION_MAJOR >= 1
+            // Shared primitives are owned by the process-wide cache
+            if (MKLDNNPrimitiveCache::get().release(p))
+            {
+                continue;
+            }
+#endif
             delete p;
         }
         for (auto m : ctx->mkldnn_memories)
@@ -17,6 +17,7 @@
 #pragma once
 
 #include <condition_variable>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <mutex>
@@ -51,6 +52,18 @@ namespace ngraph
             using DestroyContextFuncCG = std::function<DestroyContextFuncTy>;
             using EntryPoint = std::function<EntryPointTy>;
 
+            /// \brief Counters collected while incremental execution is enabled.
+            ///
+            /// executed_ops and skipped_ops are only collected in direct execution mode.
+            struct IncrementalExecutionStats
+            {
+                size_t calls = 0;
+                size_t changed_inputs = 0;
+                size_t unchanged_inputs = 0;
+                size_t executed_ops = 0;
+                size_t skipped_ops = 0;
+            };
+
             // Compile and execute graphs
             class CPU_CallFrame
             {
@@ -73,6 +86,33 @@ namespace ngraph
                 void propagate_layouts(const std::vector<std::shared_ptr<runtime::Tensor>>& tvs,
                                        const LayoutDescriptorPtrs& layouts) const;
 
+                /// \brief Run the function once on every runtime context that has not been
+                ///        executed yet, so that first-iteration setup (MKL-DNN primitive
+                ///        creation, buffer binding, TBB flow graph construction, JIT) does not
+                ///        add latency to the first real call.
+                ///
+                /// Results of the warm-up run are discarded and the next call on each context
+                /// recomputes everything. If an op throws, the warning is logged and the
+                /// remaining setup happens on the first call. Must not be invoked concurrently
+                /// with call().
+                void warm_up(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                             const std::vector<std::shared_ptr<runtime::Tensor>>& inputs);
+
+                /// \brief Enable or disable input-change-aware incremental execution.
+                ///
+                /// When enabled, the content of every input is compared with a copy kept from
+                /// the previous call on the same runtime context, and only inputs that differ
+                /// are treated as stale. The copies hold one set of inputs per context. Ops whose
+                /// inputs are all unchanged are skipped, reusing the intermediate results of the
+                /// previous call. Staleness set on the input tensors is ignored in this mode. In
+                /// direct execution mode with more than one runtime context
+                /// (NGRAPH_CPU_CONCURRENCY > 1) every op is recomputed, since the executor keeps a
+                /// single set of stale flags for all contexts.
+                void set_incremental_execution(bool enable);
+                bool get_incremental_execution() const { return m_incremental_execution; }
+                IncrementalExecutionStats get_incremental_execution_stats();
+                void reset_incremental_execution_stats();
+
                 void setup_runtime_context(runtime::Allocator* allocator);
                 void setup_cg_runtime_context();
                 void cleanup_runtime_context();
@@ -97,6 +137,18 @@ namespace ngraph
                 std::unordered_map<size_t, bool> m_id_pool;
                 std::vector<CPURuntimeContext*> m_ctx_vec;
 
+                bool m_incremental_execution = false;
+                // An input as seen by the previous call. The digest rejects most changed inputs
+                // without a full compare.
+                struct InputSnapshot
+                {
+                    uint64_t digest{0};
+                    std::vector<char> content;
+                };
+                // Per runtime context snapshot of each input
+                std::vector<std::vector<InputSnapshot>> m_input_snapshots;
+                IncrementalExecutionStats m_incremental_stats;
+
                 // Codegen specific
 
                 /// Function that initializes the context used in codegen mode.
@@ -14,6 +14,9 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+#include <cstring>
+
 #if defined(NGRAPH_TBB_ENABLE)
 #include <tbb/tbb_stddef.h>
 #endif
@@ -24,6 +27,24 @@
 #include "ngraph/env_util.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/log.hpp"
+#include "ngraph/op/divide.hpp"
+#include "ngraph/op/embedding_lookup.hpp"
+#include "ngraph/op/experimental/dyn_broadcast.hpp"
+#include "ngraph/op/experimental/dyn_pad.hpp"
+#include "ngraph/op/experimental/dyn_replace_slice.hpp"
+#include "ngraph/op/experimental/dyn_reshape.hpp"
+#include "ngraph/op/experimental/dyn_slice.hpp"
+#include "ngraph/op/experimental/range.hpp"
+#include "ngraph/op/experimental/tile.hpp"
+#include "ngraph/op/fused/scatter_nd.hpp"
+#include "ngraph/op/gather.hpp"
+#include "ngraph/op/gather_nd.hpp"
+#include "ngraph/op/one_hot.hpp"
+#include "ngraph/op/reverse_sequence.hpp"
+#include "ngraph/op/scatter_add.hpp"
+#include "ngraph/op/scatter_nd_add.hpp"
+#include "ngraph/op/tensor_iterator.hpp"
+#include "ngraph/op/topk.hpp"
 #include "ngraph/runtime/backend_manager.hpp"
 #include "ngraph/runtime/cpu/cpu_backend.hpp"
 #include "ngraph/runtime/cpu/cpu_builder_registry.hpp"
@@ -56,6 +77,11 @@ runtime::cpu::CPU_Executable::CPU_Executable(shared_ptr<Function> func,
         instance.m_call_frame = dynamic_pointer_cast<CPU_CallFrame>(cf);
     }
     set_parameters_and_results(*func);
+
+    if (pass_config.get_pass_attribute("CPUWarmUp"))
+    {
+        warm_up();
+    }
 }
 
 std::shared_ptr<ngraph::runtime::cpu::CPU_CallFrame> runtime::cpu::CPU_Executable::get_call_frame()
@@ -64,6 +90,100 @@ std::shared_ptr<ngraph::runtime::cpu::CPU_CallFrame> runtime::cpu::CPU_Executabl
     return instance.m_call_frame;
 }
 
+template <typename T>
+static void fill_ones(runtime::Tensor& tensor)
+{
+    T* data = reinterpret_cast<T*>(static_cast<runtime::cpu::CPUTensor&>(tensor).get_data_ptr());
+    std::fill(data, data + tensor.get_element_count(), T(1));
+}
+
+// Ops that read indices, bounds, counts or divisors from tensors can fault on synthetic
+// inputs, since values derived from the inputs (e.g. x - x) are not all ones
+static bool is_data_dependent(const Node& node)
+{
+    if (is_type<op::Divide>(&node))
+    {
+        return node.get_element_type().is_integral();
+    }
+    return is_type<op::DynBroadcast>(&node) || is_type<op::DynPad>(&node) ||
+           is_type<op::DynReplaceSlice>(&node) || is_type<op::DynReshape>(&node) ||
+           is_type<op::DynSlice>(&node) || is_type<op::EmbeddingLookup>(&node) ||
+           is_type<op::Gather>(&node) || is_type<op::GatherND>(&node) ||
+           is_type<op::OneHot>(&node) || is_type<op::Range>(&node) ||
+           is_type<op::ReverseSequence>(&node) || is_type<op::ScatterAdd>(&node) ||
+           is_type<op::ScatterND>(&node) || is_type<op::ScatterNDAdd>(&node) ||
+           is_type<op::Tile>(&node) || is_type<op::TopK>(&node);
+}
+
+static bool has_data_dependent_ops(const ResultVector& results)
+{
+    bool found = false;
+    traverse_nodes(NodeVector(results.begin(), results.end()), [&](shared_ptr<Node> node) {
+        if (found || is_data_dependent(*node))
+        {
+            found = true;
+        }
+        else if (auto ti = as_type_ptr<op::TensorIterator>(node))
+        {
+            found = has_data_dependent_ops(ti->get_body()->get_results());
+        }
+    });
+    return found;
+}
+
+// Ones rather than zeros, so that floating point division and similar ops stay finite
+static void fill_warm_up_input(runtime::Tensor& tensor)
+{
+    switch (tensor.get_element_type())
+    {
+    case element::Type_t::boolean: fill_ones<char>(tensor); break;
+    case element::Type_t::bf16: fill_ones<bfloat16>(tensor); break;
+    case element::Type_t::f16: fill_ones<float16>(tensor); break;
+    case element::Type_t::f32: fill_ones<float>(tensor); break;
+    case element::Type_t::f64: fill_ones<double>(tensor); break;
+    case element::Type_t::i8: fill_ones<int8_t>(tensor); break;
+    case element::Type_t::i16: fill_ones<int16_t>(tensor); break;
+    case element::Type_t::i32: fill_ones<int32_t>(tensor); break;
+    case element::Type_t::i64: fill_ones<int64_t>(tensor); break;
+    case element::Type_t::u8: fill_ones<uint8_t>(tensor); break;
+    case element::Type_t::u16: fill_ones<uint16_t>(tensor); break;
+    case element::Type_t::u32: fill_ones<uint32_t>(tensor); break;
+    case element::Type_t::u64: fill_ones<uint64_t>(tensor); break;
+    case element::Type_t::u1:
+    case element::Type_t::undefined:
+    case element::Type_t::dynamic:
+        memset(static_cast<runtime::cpu::CPUTensor&>(tensor).get_data_ptr(),
+               0,
+               tensor.get_size_in_bytes());
+        break;
+    }
+}
+
+void runtime::cpu::CPU_Executable::warm_up()
+{
+    auto function = m_function_instance.m_external_function->get_function();
+    if (has_data_dependent_ops(function->get_results()))
+    {
+        NGRAPH_DEBUG << "Skipping CPU warm-up of " << function->get_name()
+                     << ", its ops depend on input values";
+        return;
+    }
+
+    vector<shared_ptr<runtime::Tensor>> inputs;
+    vector<shared_ptr<runtime::Tensor>> outputs;
+    for (size_t i = 0; i < get_parameters().size(); i++)
+    {
+        auto tensor = create_input_tensor(i);
+        fill_warm_up_input(*tensor);
+        inputs.push_back(tensor);
+    }
+    for (size_t i = 0; i < get_results().size(); i++)
+    {
+        outputs.push_back(create_output_tensor(i));
+    }
+    m_function_instance.m_call_frame->warm_up(outputs, inputs);
+}
+
 bool runtime::cpu::CPU_Executable::call(const vector<shared_ptr<runtime::Tensor>>& outputs,
                                         const vector<shared_ptr<runtime::Tensor>>& inputs)
 {
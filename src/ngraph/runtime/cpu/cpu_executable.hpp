@@ -46,6 +46,16 @@ namespace ngraph
 
                 std::shared_ptr<CPU_CallFrame> get_call_frame();
 
+                /// \brief Perform all first-call setup on every runtime context by running the
+                ///        function once on inputs filled with ones.
+                ///
+                /// Invoked at compile time when the "CPUWarmUp" pass attribute is set. Ops with
+                /// state (e.g. random number generators) advance as if called once. Functions
+                /// with ops that read indices, bounds or integer divisors from tensors (e.g.
+                /// Gather, OneHot, DynSlice) are not warmed up, their setup stays on the first
+                /// call.
+                void warm_up();
+
                 std::vector<PerformanceCounter> get_performance_data() const override;
 
                 std::shared_ptr<runtime::Tensor> create_input_tensor(size_t input_index) override;
@@ -68,6 +68,13 @@ static int GetNumThreadPools()
     return count < 1 ? 1 : count;
 }
 
+// Below this much work the fork/join cost of the Eigen thread pool outweighs the gain
+static size_t GetParallelThreshold()
+{
+    const auto threshold = ngraph::getenv_int("NGRAPH_CPU_PARALLEL_THRESHOLD");
+    return threshold < 0 ? 32768 : static_cast<size_t>(threshold);
+}
+
 namespace ngraph
 {
     namespace runtime
@@ -80,6 +87,7 @@ namespace ngraph
                     : m_num_thread_pools(num_thread_pools)
                 {
                     m_num_cores = GetNumCores();
+                    m_parallel_threshold = GetParallelThreshold();
                     for (int i = 0; i < num_thread_pools; i++)
                     {
                         int num_threads_per_pool;
@@ -111,6 +119,10 @@ namespace ngraph
                         m_thread_pool_devices.push_back(
                             std::unique_ptr<Eigen::ThreadPoolDevice>(new Eigen::ThreadPoolDevice(
                                 m_thread_pools[i].get(), num_threads_per_pool)));
+                        // A single-thread device takes Eigen's inline path without the cost
+                        // model, and keeps the vectorized evaluation of the pool executor
+                        m_inline_devices.push_back(std::unique_ptr<Eigen::ThreadPoolDevice>(
+                            new Eigen::ThreadPoolDevice(m_thread_pools[i].get(), 1)));
 #if defined(NGRAPH_TBB_ENABLE)
                         m_tbb_arenas.emplace_back(1);
 #endif
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <functional>
 #include <thread>
 
@@ -51,6 +52,13 @@ namespace ngraph
                         return *m_thread_pool_devices[id].get();
                     }
 
+                    /// \brief Device of the same arena that always evaluates on the calling
+                    ///        thread.
+                    Eigen::ThreadPoolDevice& get_inline_device(int id)
+                    {
+                        return *m_inline_devices[id].get();
+                    }
+
 #if defined(NGRAPH_TBB_ENABLE)
                     void execute(CPUKernelFunctor& f,
                                  CPURuntimeContext* ctx,
@@ -63,17 +71,55 @@ namespace ngraph
 #endif
                     int get_num_thread_pools() { return m_num_thread_pools; }
                     int get_num_cores() { return m_num_cores; }
+                    /// \brief Estimated work (element count times per-element cost) below which
+                    ///        Eigen kernels run inline on the calling thread instead of on the
+                    ///        thread pool. Set with NGRAPH_CPU_PARALLEL_THRESHOLD; 0 always
+                    ///        uses the thread pool.
+                    size_t get_parallel_threshold() const { return m_parallel_threshold; }
+                    void set_parallel_threshold(size_t threshold)
+                    {
+                        m_parallel_threshold = threshold;
+                    }
+
                 private:
                     std::vector<std::unique_ptr<Eigen::ThreadPool>> m_thread_pools;
                     std::vector<std::unique_ptr<Eigen::ThreadPoolDevice>> m_thread_pool_devices;
+                    std::vector<std::unique_ptr<Eigen::ThreadPoolDevice>> m_inline_devices;
 #if defined(NGRAPH_TBB_ENABLE)
                     std::vector<tbb::task_arena> m_tbb_arenas;
 #endif
                     int m_num_thread_pools;
                     int m_num_cores;
+                    std::atomic<size_t> m_parallel_threshold;
                 };
 
                 extern CPUExecutor& GetCPUExecutor();
+
+                /// \brief Approximate per-element cost of elementwise kernels, relative to an add.
+                namespace cost
+                {
+                    constexpr size_t cheap = 1;
+                    constexpr size_t divide = 4;
+                    constexpr size_t transcendental = 16;
+                }
+
+                /// \brief Evaluates expr into out, using the thread pool of the given arena only
+                ///        when count * element_cost reaches the parallel threshold. Small tensors
+                ///        are evaluated inline, avoiding the fork/join cost of the pool.
+                template <typename Out, typename Expr>
+                void evaluate(
+                    Out& out, const Expr& expr, size_t count, size_t element_cost, int arena)
+                {
+                    auto& executor = GetCPUExecutor();
+                    if (count * element_cost < executor.get_parallel_threshold())
+                    {
+                        out.device(executor.get_inline_device(arena)) = expr;
+                    }
+                    else
+                    {
+                        out.device(executor.get_device(arena)) = expr;
+                    }
+                }
             }
         }
     }
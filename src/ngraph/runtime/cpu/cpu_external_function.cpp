@@ -197,6 +197,7 @@
 #include "ngraph/runtime/cpu/op/update_slice.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_assignment.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_collapse_dims.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_elementwise_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_horizontal_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_layout.hpp"
@@ -1312,6 +1313,12 @@ void runtime::cpu::CPU_ExternalFunction::register_common_passes(
     REGISTER_KNOBBED_PASS_WITH_ARGS(CPUWorkspaceInsertion, true, runtime::cpu::pass, nv_cwi, false)
     REGISTER_KNOBBED_PASS_WITH_ARGS(CPUAssignment, true, runtime::cpu::pass, this)
     REGISTER_KNOBBED_PASS_WITH_ARGS(ConstantFolding, true, ngraph::pass, GetGlobalCFDispatcherCPU())
+    // Codegen and MLIR fuse elementwise ops on their own. Opt-in through
+    // NGRAPH_PASS_ENABLES="CPUElementwiseFusion:1" until it has wider coverage.
+    if (dex && !getenv_bool("NGRAPH_MLIR"))
+    {
+        REGISTER_KNOBBED_PASS(CPUElementwiseFusion, false, runtime::cpu::pass)
+    }
     REGISTER_KNOBBED_PASS_WITH_ARGS(CPULayout, true, runtime::cpu::pass, this)
     REGISTER_KNOBBED_PASS_WITH_ARGS(
         CommonSubexpressionElimination, true, ngraph::pass, runtime::cpu::get_cse_handlers_map())
@@ -1831,6 +1838,10 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
                             [&, functor, index](const tbb::flow::continue_msg& /* msg */) {
                                 if (p(ctx) || ctx->first_iteration)
                                 {
+                                    if (ctx->collect_op_counts)
+                                    {
+                                        ctx->executed_ops++;
+                                    }
                                     if (runtime::cpu::IsTracingEnabled() || m_emit_timing)
                                     {
                                         start_ts = cpu::Clock::now();
@@ -1860,6 +1871,10 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
                                 }
                                 else
                                 {
+                                    if (ctx->collect_op_counts)
+                                    {
+                                        ctx->skipped_ops++;
+                                    }
                                     if (runtime::cpu::IsTracingEnabled())
                                     {
                                         ctx->op_durations[index] = 0;
@@ -1955,6 +1970,10 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
                 auto index = profiler_count++;
                 if ((enables.at(ctx->pc))(ctx) || ctx->first_iteration)
                 {
+                    if (ctx->collect_op_counts)
+                    {
+                        ctx->executed_ops++;
+                    }
                     // Each Op will have exactly one functor, start the clock before the exceution
                     // of functor
                     // and collect the profiler_count once the execution complets
@@ -2005,6 +2024,10 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
                 }
                 else
                 {
+                    if (ctx->collect_op_counts)
+                    {
+                        ctx->skipped_ops++;
+                    }
                     if (runtime::cpu::IsTracingEnabled())
                     {
                         ctx->op_durations[index] = 0;
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <chrono>
 #include <cstdint>
 #include <set>
@@ -79,6 +80,11 @@ namespace ngraph
                 State* const* states;
                 std::set<size_t> breakpoints;
                 size_t pc;
+                // number of ops run and skipped by the direct execution executor, only
+                // counted when collect_op_counts is set
+                bool collect_op_counts;
+                std::atomic<size_t> executed_ops;
+                std::atomic<size_t> skipped_ops;
 #ifdef NGRAPH_MLIR_ENABLE
                 /// Maps CompiledKernel nodes to their MLIR compiler
                 /// The MLIR compiler caches the compiled code on the first invocation,
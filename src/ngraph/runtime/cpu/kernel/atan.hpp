@@ -41,8 +41,12 @@ namespace ngraph
                     Eigen::TensorMap<Eigen::Tensor<ElementType, 1, Eigen::RowMajor>> in0(
                         static_cast<ElementType*>(input0), in_dims);
 
-                    out.device(ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena)) =
-                        in0.unaryExpr(Eigen::internal::scalar_atan_op<ElementType>());
+                    executor::evaluate(
+                        out,
+                        in0.unaryExpr(Eigen::internal::scalar_atan_op<ElementType>()),
+                        count,
+                        executor::cost::transcendental,
+                        arena);
                 }
             }
         }
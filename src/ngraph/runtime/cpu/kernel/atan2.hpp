@@ -45,10 +45,10 @@ namespace ngraph
                     Eigen::TensorMap<Eigen::Tensor<ElementType, 1, Eigen::RowMajor>> in1(
                         static_cast<ElementType*>(input1), in_dims);
 
-                    out.device(ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena)) =
-                        in0.binaryExpr(in1, [](ElementType y, ElementType x) {
-                            return static_cast<ElementType>(std::atan2(y, x));
-                        });
+                    auto expr = in0.binaryExpr(in1, [](ElementType y, ElementType x) {
+                        return static_cast<ElementType>(std::atan2(y, x));
+                    });
+                    executor::evaluate(out, expr, count, executor::cost::transcendental, arena);
                 }
             }
         }
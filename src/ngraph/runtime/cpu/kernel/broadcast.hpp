@@ -62,6 +62,28 @@ namespace ngraph
                     out.device(ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena)) =
                         in.broadcast(factors);
                 }
+
+                template <typename ElementType>
+                void broadcast_ref(void* input,
+                                   void* output,
+                                   const Shape& input_shape,
+                                   const Shape& output_shape,
+                                   int /* arena */)
+                {
+                    AxisSet broadcast_axes;
+                    for (size_t i = 0; i < output_shape.size(); i++)
+                    {
+                        if (input_shape[i] != output_shape[i])
+                        {
+                            broadcast_axes.insert(i);
+                        }
+                    }
+                    reference::broadcast<ElementType>(static_cast<const ElementType*>(input),
+                                                      static_cast<ElementType*>(output),
+                                                      input_shape,
+                                                      output_shape,
+                                                      broadcast_axes);
+                }
             }
         }
     }
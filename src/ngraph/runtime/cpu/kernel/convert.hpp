@@ -42,8 +42,30 @@ namespace ngraph
                     Eigen::TensorMap<Eigen::Tensor<InputElementType, 1, Eigen::RowMajor>> in(
                         static_cast<InputElementType*>(input), in_dims);
 
-                    out.device(ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena)) =
-                        in.template cast<OutputElementType>();
+                    executor::evaluate(out,
+                                       in.template cast<OutputElementType>(),
+                                       count,
+                                       executor::cost::cheap,
+                                       arena);
+                }
+
+                // bf16 has its own vectorized bulk conversions; Eigen would go one value at a time
+                template <>
+                inline void
+                    convert<bfloat16, float>(void* input, void* output, size_t count, int arena)
+                {
+                    (void)arena;
+                    bfloat16::to_float(
+                        static_cast<bfloat16*>(input), static_cast<float*>(output), count);
+                }
+
+                template <>
+                inline void
+                    convert<float, bfloat16>(void* input, void* output, size_t count, int arena)
+                {
+                    (void)arena;
+                    bfloat16::from_float(
+                        static_cast<float*>(input), static_cast<bfloat16*>(output), count);
                 }
 
                 template <typename InputElementType>
@@ -43,9 +43,9 @@ namespace ngraph
                     Eigen::TensorMap<Eigen::Tensor<ElementType, 1, Eigen::RowMajor>> in1(
                         static_cast<ElementType*>(input1), in_dims);
 
-                    out.device(ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena)) =
-                        in0.binaryExpr(in1,
-                                       Eigen::internal::scalar_pow_op<ElementType, ElementType>());
+                    auto expr = in0.binaryExpr(
+                        in1, Eigen::internal::scalar_pow_op<ElementType, ElementType>());
+                    executor::evaluate(out, expr, count, executor::cost::transcendental, arena);
                 }
             }
         }
@@ -50,8 +50,7 @@ namespace ngraph
                     Eigen::TensorMap<Eigen::Tensor<ElementType, 1, Eigen::RowMajor>> in1(
                         static_cast<ElementType*>(input1), in_dims);
 
-                    out.device(ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena)) =
-                        in0 / in1;
+                    executor::evaluate(out, in0 / in1, count, executor::cost::divide, arena);
                 }
                 template <typename ElementType>
                 typename std::enable_if<std::is_integral<ElementType>::value>::type
@@ -83,13 +82,15 @@ namespace ngraph
                         Eigen::Tensor<bool, 1, Eigen::RowMajor> if_cond =
                             ((rem != zero) && ((in0 < zero) != (in1 < zero)));
 
-                        out.device(ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(
-                            arena)) = if_cond.select(quot - one, quot);
+                        executor::evaluate(out,
+                                           if_cond.select(quot - one, quot),
+                                           count,
+                                           executor::cost::divide,
+                                           arena);
                     }
                     else
                     {
-                        out.device(ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(
-                            arena)) = in0 / in1;
+                        executor::evaluate(out, in0 / in1, count, executor::cost::divide, arena);
                     }
                 }
             }
@@ -0,0 +1,147 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+
+#include <Eigen/Core>
+
+#include "ngraph/runtime/cpu/kernel/elementwise_chain.hpp"
+
+using namespace ngraph;
+
+using Opcode = op::ElementwiseChain::Opcode;
+using Array = Eigen::Map<Eigen::ArrayXf>;
+using ConstArray = Eigen::Map<const Eigen::ArrayXf>;
+
+// Elements per tile. Every slot of a tile is 4 KB, so a chain of a few dozen ops keeps its
+// intermediates in L2.
+static const size_t s_tile_size = 1024;
+
+static void evaluate(const op::ElementwiseChain::Instruction& instruction,
+                     const std::vector<float*>& slots,
+                     float* out_ptr,
+                     size_t n)
+{
+    Array out(out_ptr, n);
+    ConstArray a(slots[instruction.operands[0]], n);
+    size_t arity = op::ElementwiseChain::get_arity(instruction.opcode);
+    if (arity == 1)
+    {
+        switch (instruction.opcode)
+        {
+        case Opcode::Negative: out = -a; break;
+        case Opcode::Abs: out = a.abs(); break;
+        case Opcode::Exp: out = a.exp(); break;
+        case Opcode::Log: out = a.log(); break;
+        case Opcode::Sqrt: out = a.sqrt(); break;
+        case Opcode::Tanh: out = a.tanh(); break;
+        case Opcode::Sigmoid: out = 1.0f / (1.0f + (-a).exp()); break;
+        case Opcode::Relu: out = a.max(0.0f); break;
+        default: break;
+        }
+        return;
+    }
+
+    ConstArray b(slots[instruction.operands[1]], n);
+    switch (instruction.opcode)
+    {
+    case Opcode::Add: out = a + b; break;
+    case Opcode::Subtract: out = a - b; break;
+    case Opcode::Multiply: out = a * b; break;
+    case Opcode::Divide: out = a / b; break;
+    case Opcode::Maximum: out = a.max(b); break;
+    case Opcode::Minimum: out = a.min(b); break;
+    case Opcode::Power: out = a.pow(b); break;
+    case Opcode::Greater: out = (a > b).cast<float>(); break;
+    case Opcode::GreaterEq: out = (a >= b).cast<float>(); break;
+    case Opcode::Less: out = (a < b).cast<float>(); break;
+    case Opcode::LessEq: out = (a <= b).cast<float>(); break;
+    case Opcode::Equal: out = (a == b).cast<float>(); break;
+    case Opcode::NotEqual: out = (a != b).cast<float>(); break;
+    case Opcode::Select:
+    {
+        ConstArray c(slots[instruction.operands[2]], n);
+        out = (a != 0.0f).select(b, c);
+        break;
+    }
+    default: break;
+    }
+}
+
+void runtime::cpu::kernel::elementwise_chain(
+    const std::vector<void*>& inputs,
+    const std::vector<bool>& boolean_inputs,
+    const std::vector<op::ElementwiseChain::InputAccess>& input_access,
+    const std::vector<op::ElementwiseChain::Instruction>& program,
+    void* output,
+    size_t count)
+{
+    size_t input_count = inputs.size();
+    size_t slot_count = input_count + program.size();
+    size_t tile_count = (count + s_tile_size - 1) / s_tile_size;
+
+#pragma omp parallel if (tile_count > 1)
+    {
+        std::vector<float> scratch(slot_count * s_tile_size);
+        std::vector<float*> slots(slot_count);
+
+#pragma omp for schedule(static)
+        for (size_t tile = 0; tile < tile_count; ++tile)
+        {
+            size_t begin = tile * s_tile_size;
+            size_t n = std::min(s_tile_size, count - begin);
+
+            for (size_t i = 0; i < input_count; ++i)
+            {
+                const auto& access = input_access[i];
+                if (!boolean_inputs[i] && access.stride == 1 && access.size == count)
+                {
+                    // Plain inputs are read in place
+                    slots[i] = static_cast<float*>(inputs[i]) + begin;
+                    continue;
+                }
+                float* dst = &scratch[i * s_tile_size];
+                if (boolean_inputs[i])
+                {
+                    const char* src = static_cast<const char*>(inputs[i]);
+                    for (size_t j = 0; j < n; ++j)
+                    {
+                        dst[j] = src[((begin + j) / access.stride) % access.size] ? 1.0f : 0.0f;
+                    }
+                }
+                else
+                {
+                    const float* src = static_cast<const float*>(inputs[i]);
+                    for (size_t j = 0; j < n; ++j)
+                    {
+                        dst[j] = src[((begin + j) / access.stride) % access.size];
+                    }
+                }
+                slots[i] = dst;
+            }
+
+            for (size_t i = 0; i < program.size(); ++i)
+            {
+                // The last instruction writes straight into the output
+                float* dst = (i + 1 == program.size())
+                                 ? static_cast<float*>(output) + begin
+                                 : &scratch[(input_count + i) * s_tile_size];
+                evaluate(program[i], slots, dst, n);
+                slots[input_count + i] = dst;
+            }
+        }
+    }
+}
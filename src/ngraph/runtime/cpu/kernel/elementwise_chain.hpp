@@ -0,0 +1,44 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <vector>
+
+#include "ngraph/runtime/cpu/op/elementwise_chain.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                /// \brief Evaluates an op::ElementwiseChain program tile by tile, so that
+                ///        intermediate results stay in cache and only the inputs and the output
+                ///        stream through memory.
+                void elementwise_chain(
+                    const std::vector<void*>& inputs,
+                    const std::vector<bool>& boolean_inputs,
+                    const std::vector<ngraph::op::ElementwiseChain::InputAccess>& input_access,
+                    const std::vector<ngraph::op::ElementwiseChain::Instruction>& program,
+                    void* output,
+                    size_t count);
+            }
+        }
+    }
+}
@@ -41,8 +41,8 @@ namespace ngraph
                     Eigen::TensorMap<Eigen::Tensor<ElementType, 1, Eigen::RowMajor>> in0(
                         static_cast<ElementType*>(input0), in_dims);
 
-                    out.device(ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena)) =
-                        in0.exp();
+                    executor::evaluate(
+                        out, in0.exp(), count, executor::cost::transcendental, arena);
                 }
             }
         }
@@ -43,8 +43,11 @@ namespace ngraph
                     Eigen::TensorMap<Eigen::Tensor<ElementType, 1, Eigen::RowMajor>> in1(
                         static_cast<ElementType*>(input1), in_dims);
 
-                    out.device(ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena)) =
-                        (in0 < in1).template cast<char>();
+                    executor::evaluate(out,
+                                       (in0 < in1).template cast<char>(),
+                                       count,
+                                       executor::cost::cheap,
+                                       arena);
                 }
             }
         }
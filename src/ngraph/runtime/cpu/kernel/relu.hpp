@@ -42,8 +42,8 @@ namespace ngraph
                     Eigen::TensorMap<Eigen::Tensor<ElementType, 1, Eigen::RowMajor>> in0(
                         static_cast<ElementType*>(input0), in_dims);
 
-                    out.device(ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena)) =
-                        in0.cwiseMax(ElementType(0));
+                    executor::evaluate(
+                        out, in0.cwiseMax(ElementType(0)), count, executor::cost::cheap, arena);
                 }
 
                 template <typename ElementType>
@@ -59,8 +59,11 @@ namespace ngraph
                     Eigen::TensorMap<Eigen::Tensor<ElementType, 1, Eigen::RowMajor>> in0(
                         static_cast<ElementType*>(input0), in_dims);
 
-                    out.device(ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena)) =
-                        in0.cwiseMax(ElementType(0)).cwiseMin(alpha);
+                    executor::evaluate(out,
+                                       in0.cwiseMax(ElementType(0)).cwiseMin(alpha),
+                                       count,
+                                       executor::cost::cheap,
+                                       arena);
                 }
 
                 template <typename ElementType>
@@ -76,8 +79,8 @@ namespace ngraph
                     Eigen::TensorMap<Eigen::Tensor<ElementType, 1, Eigen::RowMajor>> in0(
                         static_cast<ElementType*>(input0), in_dims);
 
-                    out.device(ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena)) =
-                        in0.cwiseMax(in0 * alpha);
+                    executor::evaluate(
+                        out, in0.cwiseMax(in0 * alpha), count, executor::cost::cheap, arena);
                 }
 
                 template <typename ElementType>
@@ -80,63 +80,17 @@ namespace ngraph
                                                           arena);
                 }
 
-                template <typename ElementType, unsigned int OutRank>
-                void reshape_1d(void* input,
-                                void* output,
-                                const Shape& input_shape,
-                                const AxisVector& input_axis_order,
-                                const Shape& output_shape,
-                                int arena)
+                // Transpose of a tensor whose shape has been collapsed, so that the result has
+                // the same rank as the input
+                template <typename ElementType, unsigned int Rank>
+                void transpose(void* input,
+                               void* output,
+                               const Shape& input_shape,
+                               const AxisVector& input_axis_order,
+                               const Shape& output_shape,
+                               int arena)
                 {
-                    reshape<ElementType, 1, OutRank>(static_cast<ElementType*>(input),
-                                                     static_cast<ElementType*>(output),
-                                                     input_shape,
-                                                     input_axis_order,
-                                                     output_shape,
-                                                     arena);
-                }
-
-                template <typename ElementType, unsigned int OutRank>
-                void reshape_2d(void* input,
-                                void* output,
-                                const Shape& input_shape,
-                                const AxisVector& input_axis_order,
-                                const Shape& output_shape,
-                                int arena)
-                {
-                    reshape<ElementType, 2, OutRank>(static_cast<ElementType*>(input),
-                                                     static_cast<ElementType*>(output),
-                                                     input_shape,
-                                                     input_axis_order,
-                                                     output_shape,
-                                                     arena);
-                }
-
-                template <typename ElementType, unsigned int OutRank>
-                void reshape_3d(void* input,
-                                void* output,
-                                const Shape& input_shape,
-                                const AxisVector& input_axis_order,
-                                const Shape& output_shape,
-                                int arena)
-                {
-                    reshape<ElementType, 3, OutRank>(static_cast<ElementType*>(input),
-                                                     static_cast<ElementType*>(output),
-                                                     input_shape,
-                                                     input_axis_order,
-                                                     output_shape,
-                                                     arena);
-                }
-
-                template <typename ElementType, unsigned int OutRank>
-                void reshape_4d(void* input,
-                                void* output,
-                                const Shape& input_shape,
-                                const AxisVector& input_axis_order,
-                                const Shape& output_shape,
-                                int arena)
-                {
-                    reshape<ElementType, 4, OutRank>(static_cast<ElementType*>(input),
+                    reshape<ElementType, Rank, Rank>(static_cast<ElementType*>(input),
                                                      static_cast<ElementType*>(output),
                                                      input_shape,
                                                      input_axis_order,
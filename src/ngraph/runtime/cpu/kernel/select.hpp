@@ -46,8 +46,8 @@ namespace ngraph
                     Eigen::TensorMap<Eigen::Tensor<ElementType, 1, Eigen::RowMajor>> in2(
                         static_cast<ElementType*>(input2), in_dims);
 
-                    out.device(ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena)) =
-                        in0.select(in1, in2);
+                    executor::evaluate(
+                        out, in0.select(in1, in2), count, executor::cost::cheap, arena);
                 }
             }
         }
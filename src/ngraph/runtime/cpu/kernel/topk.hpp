@@ -0,0 +1,87 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <tuple>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/reference/topk.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                // Slices along the TopK axis are independent; each thread takes a contiguous
+                // range of them and reuses one selection workspace.
+                template <typename T, typename U>
+                void topk(const T* arg,
+                          U* out_indices,
+                          T* out_values,
+                          const Shape& in_shape,
+                          const Shape& out_shape,
+                          size_t axis,
+                          size_t k,
+                          bool compute_max,
+                          op::TopK::SortType sort)
+                {
+                    const size_t slices =
+                        shape_size(in_shape) / std::max<size_t>(in_shape[axis], 1);
+#ifdef _OPENMP
+                    size_t nthr = std::min(
+                        std::max<size_t>(slices, 1),
+                        static_cast<size_t>(
+                            ngraph::runtime::cpu::executor::GetCPUExecutor().get_num_cores()));
+#pragma omp parallel num_threads(nthr) if (nthr > 1)
+                    {
+                        size_t tid = omp_get_thread_num();
+                        size_t begin = slices * tid / nthr;
+                        size_t end = slices * (tid + 1) / nthr;
+#else
+                    {
+                        size_t begin = 0;
+                        size_t end = slices;
+#endif
+                        std::vector<std::tuple<T, U>> workspace;
+                        ngraph::runtime::reference::topk_slices(arg,
+                                                                out_indices,
+                                                                out_values,
+                                                                in_shape,
+                                                                out_shape,
+                                                                axis,
+                                                                k,
+                                                                compute_max,
+                                                                sort,
+                                                                begin,
+                                                                end,
+                                                                workspace);
+                    }
+                }
+            }
+        }
+    }
+}
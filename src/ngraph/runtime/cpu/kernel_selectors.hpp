@@ -35,6 +35,11 @@
 #define SELECT_ETS(KV, ET, K) EXPAND_ETS(K, KV, ET, KERNEL_CT)
 #define SELECT_ETS_AND_RANK7(KV, ET, R, K) EXPAND_ETS_AND_RANK7(K, KV, ET, R, KERNEL_CT_R)
 
+// Ranks 1-4 only. Use with shapes collapsed by builder/collapse_dims.hpp, falling back to a
+// reference kernel for the rare shapes that still have a higher rank
+#define SELECT_KERNEL_ET_RANK4(KV, ET, R, K) EXPAND_ET11_AND_RANK4(K, KV, ET, R, KERNEL_CT_R)
+#define SELECT_ETS_AND_RANK4(KV, ET, R, K) EXPAND_ETS_AND_RANK4(K, KV, ET, R, KERNEL_CT_R)
+
 // Macros for instantiating templated kernels
 #define KERNEL_CT(K, KV, CT) KV = K<CT>
 #define KERNEL_CT_CT_CT(K, KV, CT) KV = K<CT, CT, CT>
@@ -48,6 +53,8 @@
 #define EXPAND_RANK35_AND_ET4(K, KV, R1, R2, ET, S)                                                \
     EXPAND_RANK3(K, KV, R1, EXPAND_RANK5_AND_ET4, R2, ET, S)
 #define EXPAND_ETS_AND_RANK7(K, KV, ET, R, S) EXPAND_ETS_2(K, KV, ET, EXPAND_RANK7_1, R, S)
+#define EXPAND_ET11_AND_RANK4(K, KV, ET, R, S) EXPAND_ET11(K, KV, ET, EXPAND_RANK4_1, R, S)
+#define EXPAND_ETS_AND_RANK4(K, KV, ET, R, S) EXPAND_ETS_2(K, KV, ET, EXPAND_RANK4_1, R, S)
 
 // Expander Macros that instantiate kernels for various element types and ranks
 #define EXPAND_ET4(K, KV, ET, S, A1, A2)                                                           \
@@ -314,6 +321,16 @@
     default: throw ngraph_error("Unsupported rank " + std::to_string(R) + " for kernel " #K);      \
     }
 
+#define EXPAND_RANK4_1(K, KV, R, S, A1)                                                            \
+    switch (R)                                                                                     \
+    {                                                                                              \
+    case 1: EXPAND_MACRO(S(K, KV, A1, 1)); break;                                                  \
+    case 2: EXPAND_MACRO(S(K, KV, A1, 2)); break;                                                  \
+    case 3: EXPAND_MACRO(S(K, KV, A1, 3)); break;                                                  \
+    case 4: EXPAND_MACRO(S(K, KV, A1, 4)); break;                                                  \
+    default: throw ngraph_error("Unsupported rank " + std::to_string(R) + " for kernel " #K);      \
+    }
+
 #if defined(NGRAPH_CPU_OPTIMIZE_boolean)
 #define BOOLEAN_EN 1
 #define BOOLEAN_SELECT(S, ...) EXPAND_MACRO(S(__VA_ARGS__))
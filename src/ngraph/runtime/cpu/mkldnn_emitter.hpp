@@ -49,6 +49,7 @@
 #include "ngraph/runtime/cpu/cpu_executor.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_wrapper.hpp"
 #include "ngraph/runtime/cpu/mkldnn_invoke.hpp"
+#include "ngraph/runtime/cpu/mkldnn_primitive_cache.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
 #include "ngraph/runtime/cpu/op/bounded_relu.hpp"
 #include "ngraph/runtime/cpu/op/conv_add.hpp"
@@ -1372,12 +1373,20 @@ namespace ngraph
                     mkldnn_memories[results_idx] =
                         new mkldnn::memory(desc.data.dst_desc, engine, nullptr);
 
-                    auto conv_pd = mkldnn::convolution_forward::primitive_desc(desc, attr, engine);
-                    mkldnn_scratchpad_mds[conv_idx] =
-                        new mkldnn::memory::desc(conv_pd.scratchpad_desc());
-
-                    mkldnn::primitive* prim = new mkldnn::convolution_forward(conv_pd);
-                    mkldnn_primitives[conv_idx] = prim;
+                    // Identical primitives are shared across contexts and executables
+                    mkldnn::memory::desc scratchpad_md;
+                    mkldnn_primitives[conv_idx] = MKLDNNPrimitiveCache::get().get_or_create(
+                        MKLDNNPrimitiveCache::make_key("convolution_forward", desc.data, attr),
+                        [&]() {
+                            auto conv_pd =
+                                mkldnn::convolution_forward::primitive_desc(desc, attr, engine);
+                            MKLDNNPrimitiveCache::Entry entry;
+                            entry.primitive.reset(new mkldnn::convolution_forward(conv_pd));
+                            entry.scratchpad_md = conv_pd.scratchpad_desc();
+                            return entry;
+                        },
+                        scratchpad_md);
+                    mkldnn_scratchpad_mds[conv_idx] = new mkldnn::memory::desc(scratchpad_md);
                 }
 
                 template <bool with_bias>
@@ -1412,12 +1421,20 @@ namespace ngraph
                     mkldnn_memories[results_idx] =
                         new mkldnn::memory(desc.data.dst_desc, engine, nullptr);
 
-                    auto ip_pd = mkldnn::inner_product_forward::primitive_desc(desc, attr, engine);
-                    mkldnn_scratchpad_mds[ip_idx] =
-                        new mkldnn::memory::desc(ip_pd.scratchpad_desc());
-
-                    mkldnn::primitive* prim = new mkldnn::inner_product_forward(ip_pd);
-                    mkldnn_primitives[ip_idx] = prim;
+                    // Identical primitives are shared across contexts and executables
+                    mkldnn::memory::desc scratchpad_md;
+                    mkldnn_primitives[ip_idx] = MKLDNNPrimitiveCache::get().get_or_create(
+                        MKLDNNPrimitiveCache::make_key("inner_product_forward", desc.data, attr),
+                        [&]() {
+                            auto ip_pd =
+                                mkldnn::inner_product_forward::primitive_desc(desc, attr, engine);
+                            MKLDNNPrimitiveCache::Entry entry;
+                            entry.primitive.reset(new mkldnn::inner_product_forward(ip_pd));
+                            entry.scratchpad_md = ip_pd.scratchpad_desc();
+                            return entry;
+                        },
+                        scratchpad_md);
+                    mkldnn_scratchpad_mds[ip_idx] = new mkldnn::memory::desc(scratchpad_md);
                 }
 
                 size_t query_scratchpad_sum(const mkldnn::sum::primitive_desc);
@@ -0,0 +1,190 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/runtime/cpu/mkldnn_primitive_cache.hpp"
+#include "ngraph/env_util.hpp"
+
+#if MKLDNN_VERSION_MAJOR >= 1
+
+using namespace ngraph;
+using namespace ngraph::runtime::cpu;
+
+namespace
+{
+    template <typename T>
+    void append(std::string& key, const T& value)
+    {
+        key.append(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+}
+
+MKLDNNPrimitiveCache::MKLDNNPrimitiveCache()
+{
+    int32_t capacity = getenv_int("NGRAPH_CPU_PRIMITIVE_CACHE_SIZE");
+    m_capacity = capacity < 0 ? 256 : capacity;
+}
+
+MKLDNNPrimitiveCache& MKLDNNPrimitiveCache::get()
+{
+    static MKLDNNPrimitiveCache s_cache;
+    return s_cache;
+}
+
+std::string MKLDNNPrimitiveCache::make_key(const std::string& kind,
+                                           const void* desc,
+                                           size_t desc_size,
+                                           const mkldnn::primitive_attr& attr)
+{
+    // Primitives that manage their own scratchpad are not safe to share between contexts
+    if (attr.get_scratchpad_mode() != mkldnn::scratchpad_mode::user)
+    {
+        return "";
+    }
+
+    std::string key = kind;
+    key.push_back('\0');
+    key.append(static_cast<const char*>(desc), desc_size);
+
+    int mask = 0;
+    std::vector<float> scales;
+    attr.get_output_scales(mask, scales);
+    append(key, mask);
+    append(key, scales.size());
+    key.append(reinterpret_cast<const char*>(scales.data()), scales.size() * sizeof(float));
+
+    auto ops = attr.get_post_ops();
+    append(key, ops.len());
+    for (int i = 0; i < ops.len(); i++)
+    {
+        auto op_kind = ops.kind(i);
+        append(key, op_kind);
+        if (op_kind == mkldnn::primitive::kind::sum)
+        {
+            float scale;
+            ops.get_params_sum(i, scale);
+            append(key, scale);
+        }
+        else if (op_kind == mkldnn::primitive::kind::eltwise)
+        {
+            float scale, alpha, beta;
+            mkldnn::algorithm alg;
+            ops.get_params_eltwise(i, scale, alg, alpha, beta);
+            append(key, scale);
+            append(key, alg);
+            append(key, alpha);
+            append(key, beta);
+        }
+        else
+        {
+            // Unknown post-op parameters can't be captured in the key
+            return "";
+        }
+    }
+    return key;
+}
+
+void MKLDNNPrimitiveCache::use(CachedEntry& cached)
+{
+    if (cached.users++ == 0)
+    {
+        m_unused.erase(cached.unused_position);
+    }
+}
+
+void MKLDNNPrimitiveCache::evict()
+{
+    while (m_unused.size() > m_capacity)
+    {
+        auto it = m_entries.find(m_unused.back());
+        m_keys.erase(it->second.entry.primitive.get());
+        m_entries.erase(it);
+        m_unused.pop_back();
+    }
+}
+
+mkldnn::primitive* MKLDNNPrimitiveCache::get_or_create(const std::string& key,
+                                                       const std::function<Entry()>& create,
+                                                       mkldnn::memory::desc& scratchpad_md)
+{
+    if (key.empty())
+    {
+        auto entry = create();
+        scratchpad_md = entry.scratchpad_md;
+        return entry.primitive.release();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_entries.find(key);
+        if (it != m_entries.end())
+        {
+            use(it->second);
+            scratchpad_md = it->second.entry.scratchpad_md;
+            return it->second.entry.primitive.get();
+        }
+    }
+
+    // Primitive creation can be slow (JIT), so build outside the lock and keep whichever
+    // primitive reaches the cache first
+    CachedEntry created;
+    created.entry = create();
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto result = m_entries.emplace(key, std::move(created));
+    auto& cached = result.first->second;
+    if (result.second)
+    {
+        m_keys.emplace(cached.entry.primitive.get(), key);
+        cached.users = 1;
+    }
+    else
+    {
+        use(cached);
+    }
+    scratchpad_md = cached.entry.scratchpad_md;
+    return cached.entry.primitive.get();
+}
+
+bool MKLDNNPrimitiveCache::release(const mkldnn::primitive* primitive)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto key = m_keys.find(primitive);
+    if (key == m_keys.end())
+    {
+        return false;
+    }
+    auto& cached = m_entries.at(key->second);
+    if (--cached.users == 0)
+    {
+        m_unused.push_front(key->second);
+        cached.unused_position = m_unused.begin();
+        evict();
+    }
+    return true;
+}
+
+void MKLDNNPrimitiveCache::set_capacity(size_t capacity)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_capacity = capacity;
+    evict();
+}
+
+size_t MKLDNNPrimitiveCache::size() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_entries.size();
+}
+#endif
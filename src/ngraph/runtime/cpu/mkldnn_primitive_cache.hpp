@@ -0,0 +1,113 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include <mkldnn.hpp>
+
+#include "ngraph/runtime/cpu/cpu_backend_visibility.h"
+
+#if MKLDNN_VERSION_MAJOR >= 1
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            /// \brief Process-wide cache of MKL-DNN primitives shared by every runtime context
+            ///        and executable.
+            ///
+            /// Primitives are keyed by their operation descriptor and attributes. Only primitives
+            /// that use a user-provided scratchpad are cached, since those carry no mutable state
+            /// and can run concurrently from several contexts. Each get_or_create is paired with a
+            /// release, cached primitives must not be deleted by their users. Primitives no
+            /// context uses are kept for reuse, up to the capacity set by
+            /// NGRAPH_CPU_PRIMITIVE_CACHE_SIZE (default 256), and the least recently released
+            /// are freed first. Only available with MKL-DNN v1 and later.
+            class CPU_BACKEND_API MKLDNNPrimitiveCache
+            {
+            public:
+                struct Entry
+                {
+                    std::unique_ptr<mkldnn::primitive> primitive;
+                    mkldnn::memory::desc scratchpad_md;
+                };
+
+                static MKLDNNPrimitiveCache& get();
+
+                /// \brief Builds the cache key for an operation descriptor (the C struct behind
+                ///        an mkldnn op desc) and its attributes. Returns an empty key when the
+                ///        attributes cannot be cached.
+                template <typename T>
+                static std::string make_key(const std::string& kind,
+                                            const T& desc,
+                                            const mkldnn::primitive_attr& attr)
+                {
+                    return make_key(kind, &desc, sizeof(T), attr);
+                }
+
+                /// \brief Returns the primitive cached under key, calling create to build it on a
+                ///        miss. An empty key bypasses the cache and hands ownership of the new
+                ///        primitive to the caller.
+                mkldnn::primitive* get_or_create(const std::string& key,
+                                                 const std::function<Entry()>& create,
+                                                 mkldnn::memory::desc& scratchpad_md);
+
+                /// \brief Drops one use of a primitive returned by get_or_create.
+                /// \return false if the primitive is not owned by the cache, the caller then
+                ///         deletes it.
+                bool release(const mkldnn::primitive* primitive);
+
+                /// \brief Sets how many unused primitives are kept, evicting any beyond it.
+                void set_capacity(size_t capacity);
+
+                size_t size() const;
+
+            private:
+                struct CachedEntry
+                {
+                    Entry entry;
+                    size_t users = 0;
+                    // Position in m_unused while no context uses the primitive
+                    std::list<std::string>::iterator unused_position;
+                };
+
+                MKLDNNPrimitiveCache();
+                static std::string make_key(const std::string& kind,
+                                            const void* desc,
+                                            size_t desc_size,
+                                            const mkldnn::primitive_attr& attr);
+                void use(CachedEntry& cached);
+                void evict();
+
+                mutable std::mutex m_mutex;
+                size_t m_capacity;
+                std::unordered_map<std::string, CachedEntry> m_entries;
+                std::unordered_map<const mkldnn::primitive*, std::string> m_keys;
+                // Keys of unused entries, most recently released first
+                std::list<std::string> m_unused;
+            };
+        }
+    }
+}
+#endif
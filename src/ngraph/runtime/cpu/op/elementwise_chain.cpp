@@ -0,0 +1,108 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/runtime/cpu/op/elementwise_chain.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+constexpr NodeTypeInfo op::ElementwiseChain::type_info;
+
+size_t op::ElementwiseChain::get_arity(Opcode opcode)
+{
+    switch (opcode)
+    {
+    case Opcode::Negative:
+    case Opcode::Abs:
+    case Opcode::Exp:
+    case Opcode::Log:
+    case Opcode::Sqrt:
+    case Opcode::Tanh:
+    case Opcode::Sigmoid:
+    case Opcode::Relu: return 1;
+    case Opcode::Select: return 3;
+    default: return 2;
+    }
+}
+
+op::ElementwiseChain::ElementwiseChain(const OutputVector& args,
+                                       const vector<InputAccess>& input_access,
+                                       const vector<Instruction>& program,
+                                       const Shape& shape)
+    : Op(args)
+    , m_input_access(input_access)
+    , m_program(program)
+    , m_shape(shape)
+{
+    constructor_validate_and_infer_types();
+}
+
+void op::ElementwiseChain::validate_and_infer_types()
+{
+    size_t input_count = get_input_size();
+    size_t element_count = shape_size(m_shape);
+    NODE_VALIDATION_CHECK(this,
+                          m_input_access.size() == input_count,
+                          "Expected an access pattern for each of the ",
+                          input_count,
+                          " inputs, got ",
+                          m_input_access.size());
+    NODE_VALIDATION_CHECK(this, !m_program.empty(), "Program is empty");
+
+    for (size_t i = 0; i < input_count; ++i)
+    {
+        const auto& et = get_input_element_type(i);
+        NODE_VALIDATION_CHECK(this,
+                              et == element::f32 || et == element::boolean,
+                              "Input ",
+                              i,
+                              " must be f32 or boolean, got ",
+                              et);
+        const auto& access = m_input_access[i];
+        NODE_VALIDATION_CHECK(this,
+                              access.stride > 0 && access.size > 0 &&
+                                  element_count % (access.stride * access.size) == 0 &&
+                                  shape_size(get_input_shape(i)) == access.size,
+                              "Access pattern of input ",
+                              i,
+                              " does not fit the output shape ",
+                              m_shape);
+    }
+
+    for (size_t i = 0; i < m_program.size(); ++i)
+    {
+        const auto& instruction = m_program[i];
+        for (size_t j = 0; j < get_arity(instruction.opcode); ++j)
+        {
+            NODE_VALIDATION_CHECK(this,
+                                  instruction.operands[j] < input_count + i,
+                                  "Instruction ",
+                                  i,
+                                  " reads operand ",
+                                  instruction.operands[j],
+                                  " before it is defined");
+        }
+    }
+
+    set_output_type(0, element::f32, m_shape);
+}
+
+shared_ptr<Node> op::ElementwiseChain::copy_with_new_args(const NodeVector& new_args) const
+{
+    check_new_args_count(this, new_args);
+    return make_shared<ElementwiseChain>(
+        as_output_vector(new_args), m_input_access, m_program, m_shape);
+}
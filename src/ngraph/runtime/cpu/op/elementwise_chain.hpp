@@ -0,0 +1,101 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <array>
+#include <vector>
+
+#include "ngraph/op/op.hpp"
+#include "ngraph/runtime/cpu/cpu_backend_visibility.h"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief A chain of f32 elementwise ops over one shape, evaluated by the CPU backend in a
+        ///        single pass over cache-sized tiles instead of one pass per op.
+        ///
+        /// The program is a list of instructions. Operands index the chain inputs first, then the
+        /// results of earlier instructions; the result of the last instruction is the output.
+        /// Comparisons produce 0/1 and boolean inputs are read as 0/1, so Select can be chained.
+        class ElementwiseChain : public Op
+        {
+        public:
+            CPU_BACKEND_API
+            static constexpr NodeTypeInfo type_info{"ElementwiseChain", 0};
+            const NodeTypeInfo& get_type_info() const override { return type_info; }
+            enum class Opcode
+            {
+                Add,
+                Subtract,
+                Multiply,
+                Divide,
+                Maximum,
+                Minimum,
+                Power,
+                Negative,
+                Abs,
+                Exp,
+                Log,
+                Sqrt,
+                Tanh,
+                Sigmoid,
+                Relu,
+                Greater,
+                GreaterEq,
+                Less,
+                LessEq,
+                Equal,
+                NotEqual,
+                Select
+            };
+
+            struct Instruction
+            {
+                Opcode opcode;
+                std::array<size_t, 3> operands;
+            };
+
+            /// Element i of the output reads element (i / stride) % size of the input, which
+            /// covers plain inputs as well as broadcasts that keep a contiguous run of axes.
+            struct InputAccess
+            {
+                size_t stride;
+                size_t size;
+            };
+
+            /// \return The number of operands taken by an opcode
+            CPU_BACKEND_API static size_t get_arity(Opcode opcode);
+
+            CPU_BACKEND_API ElementwiseChain(const OutputVector& args,
+                                             const std::vector<InputAccess>& input_access,
+                                             const std::vector<Instruction>& program,
+                                             const Shape& shape);
+
+            void validate_and_infer_types() override;
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+
+            const std::vector<InputAccess>& get_input_access() const { return m_input_access; }
+            const std::vector<Instruction>& get_program() const { return m_program; }
+        private:
+            std::vector<InputAccess> m_input_access;
+            std::vector<Instruction> m_program;
+            Shape m_shape;
+        };
+    }
+}
@@ -0,0 +1,340 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <map>
+#include <tuple>
+#include <typeindex>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/abs.hpp"
+#include "ngraph/op/add.hpp"
+#include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/divide.hpp"
+#include "ngraph/op/equal.hpp"
+#include "ngraph/op/exp.hpp"
+#include "ngraph/op/greater.hpp"
+#include "ngraph/op/greater_eq.hpp"
+#include "ngraph/op/less.hpp"
+#include "ngraph/op/less_eq.hpp"
+#include "ngraph/op/log.hpp"
+#include "ngraph/op/maximum.hpp"
+#include "ngraph/op/minimum.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/negative.hpp"
+#include "ngraph/op/not_equal.hpp"
+#include "ngraph/op/power.hpp"
+#include "ngraph/op/relu.hpp"
+#include "ngraph/op/select.hpp"
+#include "ngraph/op/sigmoid.hpp"
+#include "ngraph/op/sqrt.hpp"
+#include "ngraph/op/subtract.hpp"
+#include "ngraph/op/tanh.hpp"
+#include "ngraph/runtime/cpu/op/elementwise_chain.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_elementwise_fusion.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+#define TI(x) type_index(typeid(x))
+
+using Opcode = op::ElementwiseChain::Opcode;
+using InputAccess = op::ElementwiseChain::InputAccess;
+
+// Beyond this many streams the tiles stop fitting in L1/L2 and fusion stops paying off
+static const size_t s_max_inputs = 16;
+
+static const unordered_map<type_index, Opcode>& get_opcodes()
+{
+    static const unordered_map<type_index, Opcode> opcodes{
+        {TI(op::Add), Opcode::Add},
+        {TI(op::Subtract), Opcode::Subtract},
+        {TI(op::Multiply), Opcode::Multiply},
+        {TI(op::Divide), Opcode::Divide},
+        {TI(op::Maximum), Opcode::Maximum},
+        {TI(op::Minimum), Opcode::Minimum},
+        {TI(op::Power), Opcode::Power},
+        {TI(op::Negative), Opcode::Negative},
+        {TI(op::Abs), Opcode::Abs},
+        {TI(op::Exp), Opcode::Exp},
+        {TI(op::Log), Opcode::Log},
+        {TI(op::Sqrt), Opcode::Sqrt},
+        {TI(op::Tanh), Opcode::Tanh},
+        {TI(op::Sigmoid), Opcode::Sigmoid},
+        {TI(op::Relu), Opcode::Relu},
+        {TI(op::Greater), Opcode::Greater},
+        {TI(op::GreaterEq), Opcode::GreaterEq},
+        {TI(op::Less), Opcode::Less},
+        {TI(op::LessEq), Opcode::LessEq},
+        {TI(op::Equal), Opcode::Equal},
+        {TI(op::NotEqual), Opcode::NotEqual},
+        {TI(op::Select), Opcode::Select}};
+    return opcodes;
+}
+
+static bool is_comparison(Opcode opcode)
+{
+    return opcode >= Opcode::Greater && opcode <= Opcode::NotEqual;
+}
+
+static bool can_fuse(const shared_ptr<Node>& node)
+{
+    return node->get_output_size() == 1 && node->get_control_dependencies().empty() &&
+           node->get_output_partial_shape(0).is_static();
+}
+
+// An elementwise op over the chain's shape that the kernel can evaluate
+static bool is_fusible(const shared_ptr<Node>& node, const Shape& shape)
+{
+    auto it = get_opcodes().find(TI(*node));
+    if (it == get_opcodes().end() || !can_fuse(node) || node->get_output_shape(0) != shape)
+    {
+        return false;
+    }
+    Opcode opcode = it->second;
+    auto output_type = is_comparison(opcode) ? element::boolean : element::f32;
+    if (node->get_output_element_type(0) != output_type)
+    {
+        return false;
+    }
+    for (size_t i = 0; i < node->get_input_size(); ++i)
+    {
+        auto input_type =
+            (opcode == Opcode::Select && i == 0) ? element::boolean : element::f32;
+        if (node->get_input_element_type(i) != input_type || node->get_input_shape(i) != shape)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// A Broadcast whose kept axes are contiguous, so the kernel can index its argument directly
+static bool get_broadcast_access(const shared_ptr<Node>& node,
+                                 const Shape& shape,
+                                 InputAccess& access)
+{
+    auto broadcast = as_type_ptr<op::v0::Broadcast>(node);
+    if (!broadcast || !can_fuse(node) || node->get_output_shape(0) != shape)
+    {
+        return false;
+    }
+    auto element_type = node->get_input_element_type(0);
+    if (element_type != element::f32 && element_type != element::boolean)
+    {
+        return false;
+    }
+
+    vector<size_t> kept_axes;
+    for (size_t i = 0; i < shape.size(); ++i)
+    {
+        if (broadcast->get_broadcast_axes().count(i) == 0)
+        {
+            kept_axes.push_back(i);
+        }
+    }
+    if (kept_axes.empty())
+    {
+        access = InputAccess{1, 1};
+        return true;
+    }
+    if (kept_axes.back() - kept_axes.front() + 1 != kept_axes.size())
+    {
+        return false;
+    }
+    access.stride = 1;
+    for (size_t i = kept_axes.back() + 1; i < shape.size(); ++i)
+    {
+        access.stride *= shape[i];
+    }
+    access.size = shape_size(broadcast->get_input_shape(0));
+    return true;
+}
+
+static size_t get_bytes(const Output<Node>& value)
+{
+    return shape_size(value.get_shape()) * value.get_element_type().size();
+}
+
+bool runtime::cpu::pass::CPUElementwiseFusion::run_on_function(shared_ptr<Function> function)
+{
+    auto ops = function->get_ordered_ops();
+    unordered_map<Node*, size_t> position;
+    for (size_t i = 0; i < ops.size(); ++i)
+    {
+        position[ops[i].get()] = i;
+    }
+
+    unordered_set<Node*> fused;
+    bool replaced = false;
+    for (auto it = ops.rbegin(); it != ops.rend(); ++it)
+    {
+        auto root = *it;
+        if (fused.count(root.get()) != 0 || !can_fuse(root) ||
+            root->get_output_element_type(0) != element::f32)
+        {
+            continue;
+        }
+        Shape shape = root->get_output_shape(0);
+        if (shape_size(shape) == 0 || !is_fusible(root, shape))
+        {
+            continue;
+        }
+
+        // Grow the chain through producers used only inside it. A producer shared by two
+        // members only qualifies once both are in, hence the fixed point.
+        unordered_set<Node*> members{root.get()};
+        NodeVector compute{root};
+        map<Node*, InputAccess> broadcasts;
+        auto try_add = [&](const shared_ptr<Node>& producer) {
+            if (members.count(producer.get()) != 0 || fused.count(producer.get()) != 0)
+            {
+                return false;
+            }
+            for (auto& user : producer->get_users())
+            {
+                if (members.count(user.get()) == 0)
+                {
+                    return false;
+                }
+            }
+            InputAccess access;
+            if (is_fusible(producer, shape))
+            {
+                compute.push_back(producer);
+            }
+            else if (get_broadcast_access(producer, shape, access))
+            {
+                broadcasts[producer.get()] = access;
+            }
+            else
+            {
+                return false;
+            }
+            members.insert(producer.get());
+            return true;
+        };
+        bool grew = true;
+        while (grew)
+        {
+            grew = false;
+            for (size_t i = 0; i < compute.size(); ++i)
+            {
+                for (auto& value : compute[i]->input_values())
+                {
+                    grew = try_add(value.get_node_shared_ptr()) || grew;
+                }
+            }
+        }
+        if (compute.size() < 2)
+        {
+            continue;
+        }
+        sort(compute.begin(),
+             compute.end(),
+             [&](const shared_ptr<Node>& a, const shared_ptr<Node>& b) {
+                 return position.at(a.get()) < position.at(b.get());
+             });
+
+        // Chain inputs come first in the slot numbering, then one slot per instruction
+        OutputVector args;
+        vector<InputAccess> input_access;
+        map<tuple<Node*, size_t, size_t, size_t>, size_t> input_slots;
+        auto get_input_slot = [&](const Output<Node>& value, const InputAccess& access) {
+            auto key = make_tuple(value.get_node(), value.get_index(), access.stride, access.size);
+            auto slot = input_slots.find(key);
+            if (slot != input_slots.end())
+            {
+                return slot->second;
+            }
+            input_slots[key] = args.size();
+            args.push_back(value);
+            input_access.push_back(access);
+            return args.size() - 1;
+        };
+        size_t element_count = shape_size(shape);
+        size_t unfused_bytes = 0;
+        for (auto& member : compute)
+        {
+            for (auto& value : member->input_values())
+            {
+                auto producer = value.get_node();
+                auto broadcast = broadcasts.find(producer);
+                if (broadcast != broadcasts.end())
+                {
+                    get_input_slot(producer->input_value(0), broadcast->second);
+                    unfused_bytes += get_bytes(producer->input_value(0)) + get_bytes(value);
+                }
+                else if (members.count(producer) == 0)
+                {
+                    get_input_slot(value, InputAccess{1, element_count});
+                }
+                unfused_bytes += get_bytes(value);
+            }
+            unfused_bytes += get_bytes(member->output(0));
+        }
+
+        vector<op::ElementwiseChain::Instruction> program;
+        unordered_map<Node*, size_t> result_slots;
+        for (auto& member : compute)
+        {
+            op::ElementwiseChain::Instruction instruction{get_opcodes().at(TI(*member)), {}};
+            for (size_t i = 0; i < member->get_input_size(); ++i)
+            {
+                auto value = member->input_value(i);
+                auto producer = value.get_node();
+                auto broadcast = broadcasts.find(producer);
+                if (broadcast != broadcasts.end())
+                {
+                    instruction.operands[i] =
+                        get_input_slot(producer->input_value(0), broadcast->second);
+                }
+                else if (members.count(producer) != 0)
+                {
+                    instruction.operands[i] = result_slots.at(producer);
+                }
+                else
+                {
+                    instruction.operands[i] = get_input_slot(value, InputAccess{1, element_count});
+                }
+            }
+            result_slots[member.get()] = args.size() + program.size();
+            program.push_back(instruction);
+        }
+
+        size_t fused_bytes = get_bytes(root->output(0));
+        for (auto& arg : args)
+        {
+            fused_bytes += get_bytes(arg);
+        }
+        if (args.size() > s_max_inputs || 4 * fused_bytes > 3 * unfused_bytes)
+        {
+            NGRAPH_DEBUG << "Not fusing " << compute.size() << " ops ending at "
+                         << root->get_name() << ": moves " << fused_bytes << " of "
+                         << unfused_bytes << " bytes";
+            continue;
+        }
+
+        auto chain = make_shared<op::ElementwiseChain>(args, input_access, program, shape);
+        replace_node(root, chain);
+        fused.insert(members.begin(), members.end());
+        replaced = true;
+    }
+    return replaced;
+}
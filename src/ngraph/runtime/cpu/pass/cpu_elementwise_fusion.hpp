@@ -0,0 +1,49 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/pass/pass.hpp"
+#include "ngraph/runtime/cpu/cpu_backend_visibility.h"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace pass
+            {
+                class CPUElementwiseFusion;
+            }
+        }
+    }
+}
+
+/// \brief Fuses chains of f32 elementwise ops, including the broadcasts feeding them, into
+///        op::ElementwiseChain so that direct execution makes one pass over memory per chain.
+///
+/// A chain grows backwards from its last op through producers whose users are all already in
+/// the chain, so only the last op's result is ever materialized and fusion cannot create
+/// cycles. A chain is kept only when it has at least two compute ops and the bytes it moves
+/// are at most 3/4 of what the separate ops would move, which also rules out chains that would
+/// stream more distinct inputs than the tile kernel handles well.
+class CPU_BACKEND_API ngraph::runtime::cpu::pass::CPUElementwiseFusion
+    : public ngraph::pass::FunctionPass
+{
+public:
+    bool run_on_function(std::shared_ptr<ngraph::Function> function) override;
+};
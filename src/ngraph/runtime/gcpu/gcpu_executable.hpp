@@ -21,11 +21,15 @@
 #include <memory>
 #include <sstream>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 #include "ngraph/ops.hpp"
 #include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/gcpu/kernel/convolution.hpp"
+#include "ngraph/runtime/gcpu/kernel/pool.hpp"
+#include "ngraph/runtime/gcpu/kernel/topk.hpp"
 #include "ngraph/runtime/host_tensor.hpp"
 #include "ngraph/runtime/interpreter/int_executable.hpp"
 #include "ngraph/runtime/opt_kernel/broadcast.hpp"
@@ -112,6 +116,96 @@ private:
                                node.get_output_shape(0));
             break;
         }
+        case ngraph::runtime::interpreter::OP_TYPEID::Convolution:
+        {
+            if (!std::is_floating_point<T>::value)
+            {
+                op_engine<T>(node, out, args);
+                break;
+            }
+            const op::Convolution* c = static_cast<const op::Convolution*>(&node);
+            kernel::convolution<T>(args[0]->get_data_ptr<const T>(),
+                                   args[1]->get_data_ptr<const T>(),
+                                   out[0]->get_data_ptr<T>(),
+                                   node.get_input_shape(0),
+                                   node.get_input_shape(1),
+                                   node.get_output_shape(0),
+                                   c->get_window_movement_strides(),
+                                   c->get_window_dilation_strides(),
+                                   c->get_padding_below(),
+                                   c->get_padding_above(),
+                                   c->get_data_dilation_strides());
+            break;
+        }
+        case ngraph::runtime::interpreter::OP_TYPEID::MaxPool:
+        {
+            if (!std::is_floating_point<T>::value)
+            {
+                op_engine<T>(node, out, args);
+                break;
+            }
+            const op::MaxPool* max_pool = static_cast<const op::MaxPool*>(&node);
+            kernel::max_pool<T>(args[0]->get_data_ptr<const T>(),
+                                out[0]->get_data_ptr<T>(),
+                                node.get_input_shape(0),
+                                node.get_output_shape(0),
+                                max_pool->get_window_shape(),
+                                max_pool->get_window_movement_strides(),
+                                max_pool->get_padding_below());
+            break;
+        }
+        case ngraph::runtime::interpreter::OP_TYPEID::AvgPool:
+        {
+            // Integer averages round to nearest in the reference kernel
+            if (!std::is_floating_point<T>::value)
+            {
+                op_engine<T>(node, out, args);
+                break;
+            }
+            const op::AvgPool* avg_pool = static_cast<const op::AvgPool*>(&node);
+            kernel::avg_pool<T>(args[0]->get_data_ptr<const T>(),
+                                out[0]->get_data_ptr<T>(),
+                                node.get_input_shape(0),
+                                node.get_output_shape(0),
+                                avg_pool->get_window_shape(),
+                                avg_pool->get_window_movement_strides(),
+                                avg_pool->get_padding_below(),
+                                avg_pool->get_include_padding_in_avg_computation());
+            break;
+        }
+        case ngraph::runtime::interpreter::OP_TYPEID::TopK:
+        {
+            const op::TopK* topk = static_cast<const op::TopK*>(&node);
+            if (node.get_output_element_type(0) == element::i64)
+            {
+                kernel::topk<T, int64_t>(args[0]->get_data_ptr<const T>(),
+                                         out[0]->get_data_ptr<int64_t>(),
+                                         out[1]->get_data_ptr<T>(),
+                                         node.get_input_shape(0),
+                                         node.get_output_shape(0),
+                                         topk->get_top_k_axis(),
+                                         topk->get_k(),
+                                         topk->get_compute_max(),
+                                         topk->get_sort());
+            }
+            else if (node.get_output_element_type(0) == element::i32)
+            {
+                kernel::topk<T, int32_t>(args[0]->get_data_ptr<const T>(),
+                                         out[0]->get_data_ptr<int32_t>(),
+                                         out[1]->get_data_ptr<T>(),
+                                         node.get_input_shape(0),
+                                         node.get_output_shape(0),
+                                         topk->get_top_k_axis(),
+                                         topk->get_k(),
+                                         topk->get_compute_max(),
+                                         topk->get_sort());
+            }
+            else
+            {
+                throw ngraph_error("Unexpected type");
+            }
+            break;
+        }
         default: op_engine<T>(node, out, args); break;
         }
 #if defined(__GNUC__) && !(__GNUC__ == 4 && __GNUC_MINOR__ == 8)
@@ -0,0 +1,198 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <Eigen/Dense>
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#ifdef PARALLEL
+#include <omp.h>
+#endif
+
+#include "ngraph/coordinate_diff.hpp"
+#include "ngraph/shape.hpp"
+#include "ngraph/strides.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace gcpu
+        {
+            namespace kernel
+            {
+                // Forward convolution as im2col + GEMM. Output positions are split into tiles whose
+                // column buffer stays cache resident; (batch, tile) pairs are distributed across
+                // threads and each tile is multiplied against the whole filter bank, so all output
+                // channels reuse the same columns.
+                template <typename T>
+                void convolution(const T* data,
+                                 const T* filter,
+                                 T* out,
+                                 const Shape& data_shape,
+                                 const Shape& filter_shape,
+                                 const Shape& out_shape,
+                                 const Strides& window_movement_strides,
+                                 const Strides& window_dilation_strides,
+                                 const CoordinateDiff& padding_below,
+                                 const CoordinateDiff& padding_above,
+                                 const Strides& data_dilation_strides)
+                {
+                    (void)padding_above;
+                    using Matrix =
+                        Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+
+                    const size_t batch_size = data_shape[0];
+                    const size_t input_channels = data_shape[1];
+                    const size_t output_channels = filter_shape[0];
+                    const size_t spatial_rank = data_shape.size() - 2;
+
+                    size_t input_spatial = 1;
+                    size_t filter_spatial = 1;
+                    size_t output_spatial = 1;
+                    for (size_t d = 0; d < spatial_rank; d++)
+                    {
+                        input_spatial *= data_shape[d + 2];
+                        filter_spatial *= filter_shape[d + 2];
+                        output_spatial *= out_shape[d + 2];
+                    }
+                    const size_t rows = input_channels * filter_spatial;
+                    if (batch_size * output_channels * output_spatial == 0)
+                    {
+                        return;
+                    }
+
+                    // offsets[d][o * F_d + f] is the offset of the input element that filter tap f
+                    // meets at output position o along spatial axis d, or -1 if it falls into
+                    // padding or a hole introduced by data dilation.
+                    std::vector<std::vector<std::ptrdiff_t>> offsets(spatial_rank);
+                    std::ptrdiff_t input_stride = 1;
+                    for (size_t d = spatial_rank; d-- > 0;)
+                    {
+                        const std::ptrdiff_t input_size = data_shape[d + 2];
+                        const std::ptrdiff_t dilation = data_dilation_strides[d];
+                        const std::ptrdiff_t dilated_size = (input_size - 1) * dilation + 1;
+                        const size_t filter_size = filter_shape[d + 2];
+                        const size_t output_size = out_shape[d + 2];
+                        offsets[d].resize(output_size * filter_size);
+                        for (size_t o = 0; o < output_size; o++)
+                        {
+                            for (size_t f = 0; f < filter_size; f++)
+                            {
+                                std::ptrdiff_t i =
+                                    static_cast<std::ptrdiff_t>(o * window_movement_strides[d] +
+                                                                f * window_dilation_strides[d]) -
+                                    padding_below[d];
+                                bool valid = i >= 0 && i < dilated_size && i % dilation == 0;
+                                offsets[d][o * filter_size + f] =
+                                    valid ? (i / dilation) * input_stride : -1;
+                            }
+                        }
+                        input_stride *= input_size;
+                    }
+
+                    // Filter tap coordinates, flattened in row-major order
+                    std::vector<size_t> taps(filter_spatial * spatial_rank);
+                    for (size_t t = 0; t < filter_spatial; t++)
+                    {
+                        size_t rem = t;
+                        for (size_t d = spatial_rank; d-- > 0;)
+                        {
+                            taps[t * spatial_rank + d] = rem % filter_shape[d + 2];
+                            rem /= filter_shape[d + 2];
+                        }
+                    }
+
+                    const size_t tile_bytes = 256 * 1024;
+                    const size_t tile_size = std::min(
+                        output_spatial,
+                        std::max<size_t>(16, tile_bytes / (std::max<size_t>(rows, 1) * sizeof(T))));
+                    const size_t tile_count = (output_spatial + tile_size - 1) / tile_size;
+                    const std::ptrdiff_t work_items = batch_size * tile_count;
+
+                    Eigen::Map<const Matrix> weights(filter, output_channels, rows);
+
+#ifdef PARALLEL
+#pragma omp parallel if (work_items > 1)
+#endif
+                    {
+                        std::vector<T> columns(rows * tile_size);
+                        std::vector<size_t> position(spatial_rank);
+#ifdef PARALLEL
+#pragma omp for schedule(static)
+#endif
+                        for (std::ptrdiff_t item = 0; item < work_items; item++)
+                        {
+                            const size_t n = item / tile_count;
+                            const size_t begin = (item % tile_count) * tile_size;
+                            const size_t count = std::min(tile_size, output_spatial - begin);
+                            const T* batch_data = data + n * input_channels * input_spatial;
+
+                            size_t rem = begin;
+                            for (size_t d = spatial_rank; d-- > 0;)
+                            {
+                                position[d] = rem % out_shape[d + 2];
+                                rem /= out_shape[d + 2];
+                            }
+
+                            for (size_t p = 0; p < count; p++)
+                            {
+                                for (size_t t = 0; t < filter_spatial; t++)
+                                {
+                                    std::ptrdiff_t offset = 0;
+                                    for (size_t d = 0; d < spatial_rank && offset >= 0; d++)
+                                    {
+                                        std::ptrdiff_t o =
+                                            offsets[d][position[d] * filter_shape[d + 2] +
+                                                       taps[t * spatial_rank + d]];
+                                        offset = o < 0 ? -1 : offset + o;
+                                    }
+                                    T* column = columns.data() + t * count + p;
+                                    for (size_t c = 0; c < input_channels; c++)
+                                    {
+                                        column[c * filter_spatial * count] =
+                                            offset < 0 ? T(0)
+                                                       : batch_data[c * input_spatial + offset];
+                                    }
+                                }
+
+                                for (size_t d = spatial_rank; d-- > 0;)
+                                {
+                                    if (++position[d] < out_shape[d + 2])
+                                    {
+                                        break;
+                                    }
+                                    position[d] = 0;
+                                }
+                            }
+
+                            Eigen::Map<const Matrix> cols(columns.data(), rows, count);
+                            Eigen::Map<Matrix, 0, Eigen::OuterStride<>> result(
+                                out + n * output_channels * output_spatial + begin,
+                                output_channels,
+                                count,
+                                Eigen::OuterStride<>(output_spatial));
+                            result.noalias() = weights * cols;
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,248 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#ifdef PARALLEL
+#include <omp.h>
+#endif
+
+#include "ngraph/shape.hpp"
+#include "ngraph/strides.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace gcpu
+        {
+            namespace kernel
+            {
+                namespace detail
+                {
+                    // Reduces one spatial axis of a row-major [outer, in_size, inner] block into
+                    // [outer, out_size, inner]. Each output position only reads the window taps
+                    // that land inside the input; the inner loop runs over contiguous elements.
+                    template <typename T, bool AVERAGE>
+                    void pool_axis(const T* in,
+                                   T* out,
+                                   size_t outer,
+                                   size_t in_size,
+                                   size_t out_size,
+                                   size_t inner,
+                                   size_t window,
+                                   size_t stride,
+                                   size_t padding_below,
+                                   bool include_padding_in_avg_computation)
+                    {
+                        for (size_t i = 0; i < outer; i++)
+                        {
+                            const T* src = in + i * in_size * inner;
+                            for (size_t o = 0; o < out_size; o++)
+                            {
+                                T* dst = out + (i * out_size + o) * inner;
+                                std::ptrdiff_t start =
+                                    static_cast<std::ptrdiff_t>(o * stride) - padding_below;
+                                std::ptrdiff_t begin = std::max<std::ptrdiff_t>(start, 0);
+                                std::ptrdiff_t end = std::min<std::ptrdiff_t>(start + window,
+                                                                              in_size);
+
+                                std::fill(dst,
+                                          dst + inner,
+                                          AVERAGE ? T(0) : std::numeric_limits<T>::lowest());
+                                for (std::ptrdiff_t w = begin; w < end; w++)
+                                {
+                                    const T* row = src + w * inner;
+                                    for (size_t j = 0; j < inner; j++)
+                                    {
+                                        dst[j] = AVERAGE ? dst[j] + row[j]
+                                                         : (row[j] > dst[j] ? row[j] : dst[j]);
+                                    }
+                                }
+
+                                if (AVERAGE)
+                                {
+                                    size_t n_elements =
+                                        include_padding_in_avg_computation
+                                            ? window
+                                            : static_cast<size_t>(end - begin);
+                                    for (size_t j = 0; j < inner; j++)
+                                    {
+                                        dst[j] /= static_cast<T>(n_elements);
+                                    }
+                                }
+                            }
+                        }
+                    }
+
+                    // Max and average over a box are separable, so the window is applied one
+                    // spatial axis at a time. Each pass reuses the partial results of the previous
+                    // axes, which costs sum(window) instead of prod(window) reads per output.
+                    // Planes (batch, channel) are independent and split across threads.
+                    template <typename T, bool AVERAGE>
+                    void pool(const T* arg,
+                              T* out,
+                              const Shape& arg_shape,
+                              const Shape& out_shape,
+                              const Shape& window_shape,
+                              const Strides& window_movement_strides,
+                              const Shape& padding_below,
+                              bool include_padding_in_avg_computation)
+                    {
+                        if (shape_size(out_shape) == 0)
+                        {
+                            return;
+                        }
+                        const size_t spatial_rank = arg_shape.size() - 2;
+                        const std::ptrdiff_t planes = arg_shape[0] * arg_shape[1];
+                        const size_t in_plane = shape_size(arg_shape) / planes;
+                        const size_t out_plane = shape_size(out_shape) / planes;
+
+                        // Windows without elements are rejected here, before the parallel
+                        // region, since an exception must not escape an OpenMP thread. The window
+                        // start only grows with the output position, so an empty window can only
+                        // be the first or the last one along an axis.
+                        if (AVERAGE)
+                        {
+                            for (size_t d = 0; d < spatial_rank; d++)
+                            {
+                                std::ptrdiff_t window = window_shape[d];
+                                std::ptrdiff_t in_size = arg_shape[d + 2];
+                                std::ptrdiff_t first =
+                                    -static_cast<std::ptrdiff_t>(padding_below[d]);
+                                std::ptrdiff_t last =
+                                    first + static_cast<std::ptrdiff_t>((out_shape[d + 2] - 1) *
+                                                                        window_movement_strides[d]);
+                                bool empty = include_padding_in_avg_computation
+                                                 ? window == 0
+                                                 : first + window <= 0 || last >= in_size;
+                                if (empty)
+                                {
+                                    throw std::runtime_error(
+                                        "AvgPool elements == 0, must be non-zero");
+                                }
+                            }
+                        }
+
+                        // Largest intermediate: axes [0, d] already reduced, the rest still full
+                        size_t scratch_size = 0;
+                        for (size_t d = 0; d + 1 < spatial_rank; d++)
+                        {
+                            size_t size = 1;
+                            for (size_t k = 0; k < spatial_rank; k++)
+                            {
+                                size *= k <= d ? out_shape[k + 2] : arg_shape[k + 2];
+                            }
+                            scratch_size = std::max(scratch_size, size);
+                        }
+
+#ifdef PARALLEL
+#pragma omp parallel if (planes > 1)
+#endif
+                        {
+                            std::vector<T> scratch[2] = {std::vector<T>(scratch_size),
+                                                         std::vector<T>(scratch_size)};
+#ifdef PARALLEL
+#pragma omp for schedule(static)
+#endif
+                            for (std::ptrdiff_t plane = 0; plane < planes; plane++)
+                            {
+                                const T* src = arg + plane * in_plane;
+                                T* dst = out + plane * out_plane;
+                                if (spatial_rank == 0)
+                                {
+                                    *dst = *src;
+                                    continue;
+                                }
+
+                                size_t outer = 1;
+                                for (size_t d = 0; d < spatial_rank; d++)
+                                {
+                                    size_t in_size = arg_shape[d + 2];
+                                    size_t out_size = out_shape[d + 2];
+                                    size_t inner = 1;
+                                    for (size_t k = d + 1; k < spatial_rank; k++)
+                                    {
+                                        inner *= arg_shape[k + 2];
+                                    }
+
+                                    T* target = d + 1 == spatial_rank ? dst : scratch[d % 2].data();
+                                    pool_axis<T, AVERAGE>(src,
+                                                          target,
+                                                          outer,
+                                                          in_size,
+                                                          out_size,
+                                                          inner,
+                                                          window_shape[d],
+                                                          window_movement_strides[d],
+                                                          padding_below[d],
+                                                          include_padding_in_avg_computation);
+                                    src = target;
+                                    outer *= out_size;
+                                }
+                            }
+                        }
+                    }
+                }
+
+                template <typename T>
+                void max_pool(const T* arg,
+                              T* out,
+                              const Shape& arg_shape,
+                              const Shape& out_shape,
+                              const Shape& window_shape,
+                              const Strides& window_movement_strides,
+                              const Shape& padding_below)
+                {
+                    detail::pool<T, false>(arg,
+                                           out,
+                                           arg_shape,
+                                           out_shape,
+                                           window_shape,
+                                           window_movement_strides,
+                                           padding_below,
+                                           false);
+                }
+
+                template <typename T>
+                void avg_pool(const T* arg,
+                              T* out,
+                              const Shape& arg_shape,
+                              const Shape& out_shape,
+                              const Shape& window_shape,
+                              const Strides& window_movement_strides,
+                              const Shape& padding_below,
+                              bool include_padding_in_avg_computation)
+                {
+                    detail::pool<T, true>(arg,
+                                          out,
+                                          arg_shape,
+                                          out_shape,
+                                          window_shape,
+                                          window_movement_strides,
+                                          padding_below,
+                                          include_padding_in_avg_computation);
+                }
+            }
+        }
+    }
+}
@@ -36,6 +36,14 @@ using namespace ngraph;
 
 using descriptor::layout::DenseTensorLayout;
 
+// A Reshape that does not transpose leaves the element order unchanged, so its output can share
+// the memory of its input
+static bool is_aliasing_reshape(const Node* node)
+{
+    auto reshape = as_type<const op::Reshape>(node);
+    return reshape && !reshape->get_is_transpose();
+}
+
 runtime::interpreter::OP_TYPEID runtime::interpreter::INTExecutable::get_typeid(const Node& node)
 {
     const NodeTypeInfo& type_info = node.get_type_info();
@@ -84,6 +92,7 @@ runtime::interpreter::INTExecutable::INTExecutable(const shared_ptr<Function>& f
         m_nodes.push_back(node);
     }
     set_parameters_and_results(*m_function);
+    create_tensor_iterator_runners();
 }
 
 runtime::interpreter::INTExecutable::INTExecutable(const std::string& model_string)
@@ -96,6 +105,24 @@ runtime::interpreter::INTExecutable::INTExecutable(const std::string& model_stri
         m_nodes.push_back(node);
     }
     set_parameters_and_results(*m_function);
+    create_tensor_iterator_runners();
+}
+
+void runtime::interpreter::INTExecutable::create_tensor_iterator_runners()
+{
+    // One backend compiles every body
+    shared_ptr<runtime::Backend> backend;
+    for (auto& node : m_nodes)
+    {
+        if (auto ti = as_type_ptr<op::TensorIterator>(node))
+        {
+            if (!backend)
+            {
+                backend = make_shared<INTBackend>();
+            }
+            m_tensor_iterators[node.get()] = make_shared<TensorIteratorRunner>(*ti, backend);
+        }
+    }
 }
 
 bool runtime::interpreter::INTExecutable::call(const vector<shared_ptr<runtime::Tensor>>& outputs,
@@ -147,12 +174,28 @@ bool runtime::interpreter::INTExecutable::call(const vector<shared_ptr<runtime::
         tensor_map.insert({tensor, func_outputs[output_count]});
     }
 
+    // Ops whose work is done by binding their output to memory they already read or write
+    unordered_set<const Node*> elided_ops = bind_outputs_in_place(tensor_map, inputs, outputs);
+
     // for each ordered op in the graph
     for (auto op : m_nodes)
     {
         event::Duration d2(op->description(), "Interpreter");
-        if (op->is_parameter())
+        if (op->is_parameter() || elided_ops.count(op.get()) != 0)
+        {
+            continue;
+        }
+
+        if (is_aliasing_reshape(op.get()) &&
+            tensor_map.find(&op->output(0).get_tensor()) == tensor_map.end())
         {
+            // Alias the Reshape output to its input instead of copying
+            auto& arg = tensor_map.at(&op->input(0).get_tensor());
+            tensor_map.insert({&op->output(0).get_tensor(),
+                               make_shared<runtime::HostTensor>(op->get_output_element_type(0),
+                                                                op->get_output_shape(0),
+                                                                arg->get_data_ptr(),
+                                                                op->output(0).get_tensor().get_name())});
             continue;
         }
 
@@ -228,6 +271,66 @@ bool runtime::interpreter::INTExecutable::call(const vector<shared_ptr<runtime::
     return true;
 }
 
+unordered_set<const Node*> runtime::interpreter::INTExecutable::bind_outputs_in_place(
+    unordered_map<descriptor::Tensor*, shared_ptr<HostTensor>>& tensor_map,
+    const vector<shared_ptr<runtime::Tensor>>& inputs,
+    const vector<shared_ptr<runtime::Tensor>>& outputs)
+{
+    unordered_set<const Node*> elided_ops;
+    for (size_t output_count = 0; output_count < get_results().size(); ++output_count)
+    {
+        auto output = static_pointer_cast<runtime::HostTensor>(outputs[output_count]);
+        // Writing into the output early is only safe if no input shares its memory
+        bool aliases_input = false;
+        for (auto& input : inputs)
+        {
+            if (static_pointer_cast<runtime::HostTensor>(input)->get_data_ptr() ==
+                output->get_data_ptr())
+            {
+                aliases_input = true;
+                break;
+            }
+        }
+        if (aliases_input)
+        {
+            continue;
+        }
+
+        // Let the producer of the Result's value write straight into the output, which turns
+        // the Result copy into a no-op. Parameters and values already bound to another output
+        // keep the copy.
+        const Node* result = get_results()[output_count].get();
+        descriptor::Tensor* tensor = &result->input(0).get_tensor();
+        if (tensor_map.find(tensor) != tensor_map.end())
+        {
+            continue;
+        }
+        tensor_map.insert({tensor, output});
+        elided_ops.insert(result);
+
+        // Continue through layout preserving Reshapes so that the op feeding them writes into
+        // the output as well
+        const Node* node = result->get_input_node_ptr(0);
+        while (is_aliasing_reshape(node))
+        {
+            tensor = &node->input(0).get_tensor();
+            if (tensor_map.find(tensor) != tensor_map.end())
+            {
+                break;
+            }
+            tensor_map.insert(
+                {tensor,
+                 make_shared<runtime::HostTensor>(node->get_input_element_type(0),
+                                                  node->get_input_shape(0),
+                                                  output->get_data_ptr(),
+                                                  tensor->get_name())});
+            elided_ops.insert(node);
+            node = node->get_input_node_ptr(0);
+        }
+    }
+    return elided_ops;
+}
+
 void runtime::interpreter::INTExecutable::generate_calls(const element::Type& type,
                                                          const Node& op,
                                                          const vector<shared_ptr<HostTensor>>& out,
@@ -21,12 +21,15 @@
 #include <memory>
 #include <sstream>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "ngraph/ops.hpp"
 #include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/runtime/backend.hpp"
 #include "ngraph/runtime/host_tensor.hpp"
+#include "ngraph/runtime/interpreter/int_backend.hpp"
 #ifdef INTERPRETER_USE_HYBRID
 #include "ngraph/runtime/hybrid/op/function_call.hpp"
 #endif
@@ -116,6 +119,7 @@
 #include "ngraph/runtime/reference/topk.hpp"
 #include "ngraph/runtime/reference/xor.hpp"
 #include "ngraph/runtime/tensor.hpp"
+#include "ngraph/runtime/tensor_iterator_runner.hpp"
 #include "ngraph/state/bernoulli_rng_state.hpp"
 #include "ngraph/state/uniform_rng_state.hpp"
 
@@ -184,13 +188,30 @@ protected:
     std::unordered_map<std::shared_ptr<const Node>, stopwatch> m_timer_map;
     std::vector<std::shared_ptr<Node>> m_nodes;
     std::unordered_map<const Node*, std::shared_ptr<State>> m_states;
+    std::unordered_map<const Node*, std::shared_ptr<TensorIteratorRunner>> m_tensor_iterators;
     std::set<std::string> m_unsupported_op_name_list;
 
     static OP_TYPEID get_typeid(const Node& node);
 
+    /// \brief Compile the bodies of the function's TensorIterators, so that call() only reads
+    ///        m_tensor_iterators.
+    void create_tensor_iterator_runners();
+
     static void perform_nan_check(const std::vector<std::shared_ptr<HostTensor>>&,
                                   const Node* op = nullptr);
 
+    /// \brief Bind the values computed by the function's Results directly to the caller's
+    ///        output tensors.
+    /// \param tensor_map Map of tensors to the HostTensors holding them, updated with the
+    ///        bindings
+    /// \param inputs The tensors passed to call()
+    /// \param outputs The tensors passed to call()
+    /// \return The ops which no longer need to execute because of the bindings
+    std::unordered_set<const Node*> bind_outputs_in_place(
+        std::unordered_map<descriptor::Tensor*, std::shared_ptr<HostTensor>>& tensor_map,
+        const std::vector<std::shared_ptr<Tensor>>& inputs,
+        const std::vector<std::shared_ptr<Tensor>>& outputs);
+
     virtual void generate_calls(const element::Type& type,
                                 const Node& op,
                                 const std::vector<std::shared_ptr<HostTensor>>& outputs,
@@ -1791,6 +1812,22 @@ protected:
                 args[0]->get_data_ptr<const T>(), out[0]->get_data_ptr<T>(), element_count);
             break;
         }
+        case OP_TYPEID::TensorIterator:
+        {
+            // The body was compiled with the executable and is run as a loop
+            std::vector<void*> inputs;
+            for (auto& arg : args)
+            {
+                inputs.push_back(arg->get_data_ptr());
+            }
+            std::vector<void*> outputs;
+            for (auto& output : out)
+            {
+                outputs.push_back(output->get_data_ptr());
+            }
+            m_tensor_iterators.at(&node)->run(inputs, outputs);
+            break;
+        }
         case OP_TYPEID::TopK:
         {
             const op::TopK* topk = static_cast<const op::TopK*>(&node);
@@ -1885,8 +1922,6 @@ protected:
         case OP_TYPEID::Squeeze:
         case OP_TYPEID::Stack:
         case OP_TYPEID::Unsqueeze:
-        // Tensor Iterator not yet supported
-        case OP_TYPEID::TensorIterator:
         case OP_TYPEID::UnknownOp:
             throw unsupported_op("Unsupported op '" + node.description() + "'");
 #if defined(__GNUC__) && !(__GNUC__ == 4 && __GNUC_MINOR__ == 8)
@@ -16,9 +16,11 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cfenv>
 #include <cmath>
 #include <functional>
+#include <limits>
 
 #include "ngraph/axis_vector.hpp"
 #include "ngraph/coordinate_transform.hpp"
@@ -252,9 +254,12 @@ namespace ngraph
                     if (is_quantized)
                     {
                         float scale = *input_scale * *filter_scale / *output_scale;
-                        out[out_transform.index(out_coord)] =
-                            static_cast<OUTPUT>(std::round(static_cast<float>(result) * scale)) +
-                            *output_zero_point;
+                        // Saturate like the optimized kernels do
+                        double value = std::round(static_cast<float>(result) * scale) +
+                                       static_cast<double>(*output_zero_point);
+                        value = std::max<double>(value, std::numeric_limits<OUTPUT>::lowest());
+                        value = std::min<double>(value, std::numeric_limits<OUTPUT>::max());
+                        out[out_transform.index(out_coord)] = static_cast<OUTPUT>(value);
                     }
                     else
                     {
@@ -16,7 +16,9 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
+#include <limits>
 #include <utility>
 
 #include <cfenv>
@@ -153,9 +155,12 @@ namespace ngraph
                         {
                             float scale = *input0_scale * *input1_scale / *output_scale;
                             // Write the sum back.
-                            out[out_index] =
-                                static_cast<OUTPUT>(std::round(static_cast<float>(sum) * scale)) +
-                                *output_zero_point;
+                            // Saturate like the optimized kernels do
+                            double value = std::round(static_cast<float>(sum) * scale) +
+                                           static_cast<double>(*output_zero_point);
+                            value = std::max<double>(value, std::numeric_limits<OUTPUT>::lowest());
+                            value = std::min<double>(value, std::numeric_limits<OUTPUT>::max());
+                            out[out_index] = static_cast<OUTPUT>(value);
                         }
                         else
                         {
@@ -20,6 +20,7 @@
 #include <limits>
 
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/reduction_layout.hpp"
 #include "ngraph/shape_util.hpp"
 
 namespace ngraph
@@ -39,6 +40,14 @@ namespace ngraph
                                ? T(-std::numeric_limits<T>::infinity())
                                : std::numeric_limits<T>::min();
 
+                ReductionLayout layout;
+                if (get_reduction_layout(in_shape, reduction_axes, layout))
+                {
+                    reduce_contiguous(
+                        arg, out, layout, minval, [](T a, T x) { return x > a ? x : a; });
+                    return;
+                }
+
                 CoordinateTransform output_transform(out_shape);
 
                 for (const Coordinate& output_coord : output_transform)
@@ -19,6 +19,7 @@
 #include <cmath>
 
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/reduction_layout.hpp"
 #include "ngraph/shape_util.hpp"
 
 namespace ngraph
@@ -34,6 +35,13 @@ namespace ngraph
                          const Shape& out_shape,
                          const AxisSet& reduction_axes)
             {
+                ReductionLayout layout;
+                if (get_reduction_layout(in_shape, reduction_axes, layout))
+                {
+                    reduce_contiguous(arg, out, layout, T(1), [](T a, T x) { return a * x; });
+                    return;
+                }
+
                 CoordinateTransform output_transform(out_shape);
 
                 for (const Coordinate& output_coord : output_transform)
@@ -0,0 +1,123 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+
+#include "ngraph/axis_set.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            /// \brief A reduction viewed as a row-major [outer, reduced, inner] tensor reduced
+            ///        over its middle axis.
+            struct ReductionLayout
+            {
+                size_t outer = 1;
+                size_t reduced = 1;
+                size_t inner = 1;
+            };
+
+            /// \brief Folds `shape` into a ReductionLayout when the reduced axes form one
+            ///        contiguous block, ignoring axes of length 1.
+            ///
+            /// This covers the common reductions over the innermost axes (inner == 1) and over
+            /// the outermost axes (outer == 1), which can then be computed with contiguous
+            /// loops rather than a CoordinateTransform per element.
+            /// \return false if the reduced axes are interleaved with kept axes.
+            inline bool get_reduction_layout(const Shape& shape,
+                                             const AxisSet& reduction_axes,
+                                             ReductionLayout& layout)
+            {
+                layout = ReductionLayout();
+                bool seen_reduced = false;
+                bool seen_inner = false;
+                for (size_t i = 0; i < shape.size(); i++)
+                {
+                    if (shape[i] == 1)
+                    {
+                        continue;
+                    }
+                    if (reduction_axes.count(i) != 0)
+                    {
+                        if (seen_inner)
+                        {
+                            return false;
+                        }
+                        seen_reduced = true;
+                        layout.reduced *= shape[i];
+                    }
+                    else if (seen_reduced)
+                    {
+                        seen_inner = true;
+                        layout.inner *= shape[i];
+                    }
+                    else
+                    {
+                        layout.outer *= shape[i];
+                    }
+                }
+                return true;
+            }
+
+            /// \brief Applies `reduce_op(accumulator, value)` over the reduced axis of `layout`,
+            ///        starting each output from `init`.
+            ///
+            /// Visits the inputs of each output in the same order as a row-major
+            /// CoordinateTransform walk, so results match the generic kernels exactly.
+            template <typename T, typename OP>
+            void reduce_contiguous(
+                const T* arg, T* out, const ReductionLayout& layout, T init, OP reduce_op)
+            {
+                const size_t inner = layout.inner;
+                for (size_t o = 0; o < layout.outer; o++)
+                {
+                    const T* in_row = arg + o * layout.reduced * inner;
+                    T* out_row = out + o * inner;
+                    if (inner == 1)
+                    {
+                        T acc = init;
+                        for (size_t r = 0; r < layout.reduced; r++)
+                        {
+                            acc = reduce_op(acc, in_row[r]);
+                        }
+                        out_row[0] = acc;
+                    }
+                    else
+                    {
+                        for (size_t i = 0; i < inner; i++)
+                        {
+                            out_row[i] = init;
+                        }
+                        for (size_t r = 0; r < layout.reduced; r++)
+                        {
+                            const T* in = in_row + r * inner;
+                            for (size_t i = 0; i < inner; i++)
+                            {
+                                out_row[i] = reduce_op(out_row[i], in[i]);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
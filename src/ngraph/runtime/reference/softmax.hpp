@@ -17,8 +17,11 @@
 #pragma once
 
 #include <cmath>
+#include <vector>
+
 #include "ngraph/coordinate_transform.hpp"
 #include "ngraph/runtime/reference/max.hpp"
+#include "ngraph/runtime/reference/reduction_layout.hpp"
 #include "ngraph/runtime/reference/sum.hpp"
 #include "ngraph/shape_util.hpp"
 
@@ -28,12 +31,68 @@ namespace ngraph
     {
         namespace reference
         {
+            /// \brief Softmax over the reduced axis of `layout` in two passes.
+            ///
+            /// The first pass keeps a running maximum and a sum of exponentials rescaled
+            /// whenever the maximum grows, the second writes the normalized outputs.
+            template <typename T>
+            void softmax_contiguous(const T* arg, T* out, const ReductionLayout& layout)
+            {
+                const size_t inner = layout.inner;
+                std::vector<T> max_vals(inner);
+                std::vector<T> sums(inner);
+                for (size_t o = 0; o < layout.outer; o++)
+                {
+                    const T* in_row = arg + o * layout.reduced * inner;
+                    T* out_row = out + o * layout.reduced * inner;
+                    for (size_t i = 0; i < inner; i++)
+                    {
+                        max_vals[i] = in_row[i];
+                        sums[i] = 1;
+                    }
+                    for (size_t r = 1; r < layout.reduced; r++)
+                    {
+                        const T* in = in_row + r * inner;
+                        for (size_t i = 0; i < inner; i++)
+                        {
+                            T x = in[i];
+                            if (x > max_vals[i])
+                            {
+                                sums[i] = sums[i] * std::exp(max_vals[i] - x) + 1;
+                                max_vals[i] = x;
+                            }
+                            else
+                            {
+                                sums[i] = sums[i] + std::exp(x - max_vals[i]);
+                            }
+                        }
+                    }
+                    for (size_t r = 0; r < layout.reduced; r++)
+                    {
+                        const T* in = in_row + r * inner;
+                        T* result = out_row + r * inner;
+                        for (size_t i = 0; i < inner; i++)
+                        {
+                            result[i] = std::exp(in[i] - max_vals[i]) / sums[i];
+                        }
+                    }
+                }
+            }
+
             template <typename T>
             void softmax(const T* arg, T* out, const Shape& shape, const AxisSet& axes)
             {
+                ReductionLayout layout;
+                if (!axes.empty() && shape_size(shape) != 0 &&
+                    get_reduction_layout(shape, axes, layout))
+                {
+                    softmax_contiguous(arg, out, layout);
+                    return;
+                }
+
                 auto temp_shape = reduce(shape, axes);
-                auto temp_elements = shape_size(temp_shape);
-                auto temp_ptr = new T[temp_elements];
+                std::vector<T> temp(shape_size(temp_shape));
+                T* temp_ptr = temp.data();
 
                 max(arg, temp_ptr, shape, temp_shape, axes);
 
@@ -53,8 +112,6 @@ namespace ngraph
                     Coordinate temp_coord = reduce(coord, axes);
                     out[transform.index(coord)] /= temp_ptr[temp_transform.index(temp_coord)];
                 }
-
-                delete[] temp_ptr;
             }
         }
     }
@@ -19,6 +19,7 @@
 #include <cmath>
 
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/reduction_layout.hpp"
 #include "ngraph/shape_util.hpp"
 #include "ngraph/type/bfloat16.hpp"
 #include "ngraph/type/float16.hpp"
@@ -52,6 +53,22 @@ namespace ngraph
                 return true;
             }
 
+            // Kahan summation of x into z with running compensation c
+            template <typename T>
+            void compensated_add(T& z, T& c, T x)
+            {
+                if (is_finite(x) && is_finite(z))
+                {
+                    T t = z + (x - c);
+                    c = (t - z) - (x - c);
+                    z = t;
+                }
+                else
+                {
+                    z = z + x;
+                }
+            }
+
             template <typename T>
             void sum(const T* arg,
                      T* out,
@@ -59,6 +76,32 @@ namespace ngraph
                      const Shape& out_shape,
                      const AxisSet& reduction_axes)
             {
+                ReductionLayout layout;
+                if (get_reduction_layout(in_shape, reduction_axes, layout))
+                {
+                    const size_t inner = layout.inner;
+                    std::vector<T> cs(inner);
+                    for (size_t o = 0; o < layout.outer; o++)
+                    {
+                        const T* in_row = arg + o * layout.reduced * inner;
+                        T* out_row = out + o * inner;
+                        for (size_t i = 0; i < inner; i++)
+                        {
+                            out_row[i] = 0;
+                            cs[i] = 0;
+                        }
+                        for (size_t r = 0; r < layout.reduced; r++)
+                        {
+                            const T* in = in_row + r * inner;
+                            for (size_t i = 0; i < inner; i++)
+                            {
+                                compensated_add(out_row[i], cs[i], in[i]);
+                            }
+                        }
+                    }
+                    return;
+                }
+
                 CoordinateTransform output_transform(out_shape);
                 std::vector<T> cs(shape_size(out_shape));
 
@@ -73,21 +116,10 @@ namespace ngraph
                 for (const Coordinate& input_coord : input_transform)
                 {
                     Coordinate output_coord = reduce(input_coord, reduction_axes);
+                    size_t output_index = output_transform.index(output_coord);
 
                     T x = arg[input_transform.index(input_coord)];
-                    T& z = out[output_transform.index(output_coord)];
-
-                    if (is_finite(x) && is_finite(z))
-                    {
-                        T& c = cs[output_transform.index(output_coord)];
-                        T t = z + (x - c);
-                        c = (t - z) - (x - c);
-                        z = t;
-                    }
-                    else
-                    {
-                        z = z + x;
-                    }
+                    compensated_add(out[output_index], cs[output_index], x);
                 }
             }
         }
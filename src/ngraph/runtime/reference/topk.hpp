@@ -19,9 +19,11 @@
 #include <algorithm>
 #include <cmath>
 #include <numeric>
+#include <tuple>
+#include <vector>
 
-#include "ngraph/coordinate_transform.hpp"
 #include "ngraph/op/topk.hpp"
+#include "ngraph/shape.hpp"
 
 namespace ngraph
 {
@@ -69,107 +71,169 @@ namespace ngraph
                 return std::get<1>(a) > std::get<1>(b);
             }
 
-            template <typename T, typename U>
-            void topk(const T* arg,
-                      U* out_indices,
-                      T* out_values,
-                      const Shape& in_shape,
-                      const Shape& out_shape,
-                      size_t axis,
-                      size_t k,
-                      bool compute_max,
-                      op::TopK::SortType sort = op::TopK::SortType::NONE)
+            template <typename T, typename U, bool COMPUTE_MAX>
+            struct topk_compare
+            {
+                bool operator()(const std::tuple<T, U>& a, const std::tuple<T, U>& b) const
+                {
+                    return COMPUTE_MAX ? compare_max<T, U>(a, b) : compare_min<T, U>(a, b);
+                }
+            };
+
+            template <typename T, typename U, bool COMPUTE_MAX>
+            void topk_slice(const T* arg,
+                            size_t arg_stride,
+                            size_t n,
+                            U* out_indices,
+                            T* out_values,
+                            size_t out_stride,
+                            size_t k,
+                            op::TopK::SortType sort,
+                            std::vector<std::tuple<T, U>>& workspace)
             {
                 using namespace std;
-                // reorder source axis visit order and make "axis" inner most
-                size_t ndim = static_cast<size_t>(in_shape.size());
-                Coordinate start_corner(ndim, 0);
-                Coordinate end_corner(in_shape);
-                end_corner[axis] = 1;
-                Strides strides(ndim, 1);
-                AxisVector axis_order(ndim);
-                iota(axis_order.begin(), axis_order.end(), 0);
-                axis_order.erase(axis_order.begin() + axis);
-                axis_order.push_back(axis);
-                // Create CoordinateTransforms that visits only the first element along "axis"
-                CoordinateTransform input_transform(
-                    in_shape, start_corner, end_corner, strides, axis_order);
-                CoordinateTransform output_transform(
-                    out_shape, start_corner, end_corner, strides, axis_order);
-                // Create temp vector for sorting.
-                vector<tuple<T, U>> workspace(in_shape[axis]);
-                vector<size_t> in_strides = ngraph::row_major_strides(in_shape);
-                vector<size_t> out_strides = ngraph::row_major_strides(out_shape);
-                auto in_axis_stride = in_strides[axis];
-                auto out_axis_stride = out_strides[axis];
-                for (const Coordinate& coord : input_transform)
+                topk_compare<T, U, COMPUTE_MAX> compare;
+                workspace.clear();
+                if (k == 0)
                 {
-                    auto arg_index = input_transform.index(coord);
-                    auto out_index = output_transform.index(coord);
-                    // Fill the temp vector
-                    U i = 0;
-                    for (tuple<T, U>& entry : workspace)
+                    return;
+                }
+                // For small k, stream the slice through a bounded heap of the k best entries
+                // seen so far with the worst of them on top. Everything else goes through a
+                // full copy and nth_element. Both select the same entries since compare is a
+                // total order on (value, index).
+                if (k * 32 <= n)
+                {
+                    workspace.reserve(k);
+                    for (size_t i = 0; i < k; i++)
                     {
-                        get<0>(entry) = arg[arg_index];
-                        get<1>(entry) = i;
-                        arg_index += in_axis_stride;
-                        i++;
+                        workspace.emplace_back(arg[i * arg_stride], static_cast<U>(i));
                     }
-                    // Sort the temp vector
-                    if (compute_max)
+                    make_heap(workspace.begin(), workspace.end(), compare);
+                    for (size_t i = k; i < n; i++)
                     {
-                        nth_element(workspace.begin(),
-                                    workspace.begin() + k,
-                                    workspace.end(),
-                                    compare_max<T, U>);
+                        tuple<T, U> entry(arg[i * arg_stride], static_cast<U>(i));
+                        if (compare(entry, workspace.front()))
+                        {
+                            pop_heap(workspace.begin(), workspace.end(), compare);
+                            workspace.back() = entry;
+                            push_heap(workspace.begin(), workspace.end(), compare);
+                        }
                     }
-                    else
+                    if (sort == op::TopK::SortType::SORT_VALUES)
                     {
-                        nth_element(workspace.begin(),
-                                    workspace.begin() + k,
-                                    workspace.end(),
-                                    compare_min<T, U>);
+                        sort_heap(workspace.begin(), workspace.end(), compare);
                     }
-                    // Write temp vector to output
-                    if (compute_max)
+                }
+                else
+                {
+                    workspace.reserve(n);
+                    for (size_t i = 0; i < n; i++)
                     {
-                        switch (sort)
-                        {
-                        case op::TopK::SortType::NONE: break;
-                        case op::TopK::SortType::SORT_INDICES:
-                            std::sort(workspace.begin(),
-                                      workspace.begin() + k,
-                                      sort_indices_descending<T, U>);
-                            break;
-                        case op::TopK::SortType::SORT_VALUES:
-                            std::sort(workspace.begin(), workspace.begin() + k, compare_max<T, U>);
-                            break;
-                        }
+                        workspace.emplace_back(arg[i * arg_stride], static_cast<U>(i));
                     }
-                    else
+                    nth_element(workspace.begin(), workspace.begin() + k, workspace.end(), compare);
+                    if (sort == op::TopK::SortType::SORT_VALUES)
                     {
-                        switch (sort)
-                        {
-                        case op::TopK::SortType::NONE: break;
-                        case op::TopK::SortType::SORT_INDICES:
-                            std::sort(workspace.begin(),
-                                      workspace.begin() + k,
-                                      sort_indices_ascending<T, U>);
-                            break;
-                        case op::TopK::SortType::SORT_VALUES:
-                            std::sort(workspace.begin(), workspace.begin() + k, compare_min<T, U>);
-                            break;
-                        }
+                        std::sort(workspace.begin(), workspace.begin() + k, compare);
                     }
-                    for (size_t j = 0; j < k; j++)
+                }
+                if (sort == op::TopK::SortType::SORT_INDICES)
+                {
+                    std::sort(workspace.begin(),
+                              workspace.begin() + k,
+                              COMPUTE_MAX ? sort_indices_descending<T, U>
+                                          : sort_indices_ascending<T, U>);
+                }
+                for (size_t j = 0; j < k; j++)
+                {
+                    out_values[j * out_stride] = get<0>(workspace[j]);
+                    out_indices[j * out_stride] = get<1>(workspace[j]);
+                }
+            }
+
+            /// \brief Computes TopK on slices [begin, end) of the outer * inner slices of the
+            ///        input, where slice s starts at (s / inner) * axis_size * inner + s % inner.
+            ///        Backends split the slice range across threads.
+            template <typename T, typename U>
+            void topk_slices(const T* arg,
+                             U* out_indices,
+                             T* out_values,
+                             const Shape& in_shape,
+                             const Shape& out_shape,
+                             size_t axis,
+                             size_t k,
+                             bool compute_max,
+                             op::TopK::SortType sort,
+                             size_t begin,
+                             size_t end,
+                             std::vector<std::tuple<T, U>>& workspace)
+            {
+                size_t n = in_shape[axis];
+                size_t inner = 1;
+                for (size_t i = axis + 1; i < in_shape.size(); i++)
+                {
+                    inner *= in_shape[i];
+                }
+                size_t out_n = out_shape[axis];
+                for (size_t s = begin; s < end; s++)
+                {
+                    size_t outer_index = s / inner;
+                    size_t inner_index = s % inner;
+                    size_t arg_offset = outer_index * n * inner + inner_index;
+                    size_t out_offset = outer_index * out_n * inner + inner_index;
+                    if (compute_max)
+                    {
+                        topk_slice<T, U, true>(arg + arg_offset,
+                                               inner,
+                                               n,
+                                               out_indices + out_offset,
+                                               out_values + out_offset,
+                                               inner,
+                                               k,
+                                               sort,
+                                               workspace);
+                    }
+                    else
                     {
-                        tuple<T, U> entry = workspace[j];
-                        out_values[out_index] = get<0>(entry);
-                        out_indices[out_index] = get<1>(entry);
-                        out_index += out_axis_stride;
+                        topk_slice<T, U, false>(arg + arg_offset,
+                                                inner,
+                                                n,
+                                                out_indices + out_offset,
+                                                out_values + out_offset,
+                                                inner,
+                                                k,
+                                                sort,
+                                                workspace);
                     }
                 }
             }
+
+            template <typename T, typename U>
+            void topk(const T* arg,
+                      U* out_indices,
+                      T* out_values,
+                      const Shape& in_shape,
+                      const Shape& out_shape,
+                      size_t axis,
+                      size_t k,
+                      bool compute_max,
+                      op::TopK::SortType sort = op::TopK::SortType::NONE)
+            {
+                std::vector<std::tuple<T, U>> workspace;
+                topk_slices(arg,
+                            out_indices,
+                            out_values,
+                            in_shape,
+                            out_shape,
+                            axis,
+                            k,
+                            compute_max,
+                            sort,
+                            0,
+                            shape_size(in_shape) / std::max<size_t>(in_shape[axis], 1),
+                            workspace);
+            }
         }
     }
 }
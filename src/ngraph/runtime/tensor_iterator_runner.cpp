@@ -0,0 +1,356 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstring>
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/runtime/tensor_iterator_runner.hpp"
+#include "ngraph/validation_util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+runtime::TensorIteratorRunner::AxisSlicing::AxisSlicing(const Shape& shape,
+                                                        size_t element_size,
+                                                        int64_t start,
+                                                        int64_t stride,
+                                                        int64_t part_size,
+                                                        int64_t axis)
+    : m_inner_bytes(element_size)
+    , m_part_size(part_size)
+    , m_stride(stride)
+{
+    // Negative axes count from the last axis and negative starts from the end of the axis
+    size_t axis_index =
+        static_cast<size_t>(normalize_axis("TensorIterator slicing", axis, Rank(shape.size())));
+    m_axis_length = shape.at(axis_index);
+    m_start = start < 0 ? start + static_cast<int64_t>(m_axis_length) : start;
+    for (size_t i = 0; i < axis_index; i++)
+    {
+        m_outer_count *= shape[i];
+    }
+    for (size_t i = axis_index + 1; i < shape.size(); i++)
+    {
+        m_inner_bytes *= shape[i];
+    }
+}
+
+size_t runtime::TensorIteratorRunner::AxisSlicing::get_part_offset(int64_t iteration) const
+{
+    // With a negative stride start is the last index of the first part
+    int64_t first = m_start + iteration * m_stride;
+    if (m_stride < 0)
+    {
+        first -= static_cast<int64_t>(m_part_size) - 1;
+    }
+    NGRAPH_CHECK(first >= 0 && first + m_part_size <= m_axis_length,
+                 "TensorIterator slice for iteration ",
+                 iteration,
+                 " is out of bounds");
+    return static_cast<size_t>(first);
+}
+
+void runtime::TensorIteratorRunner::AxisSlicing::gather(const char* outer,
+                                                        char* part,
+                                                        int64_t iteration) const
+{
+    size_t first = get_part_offset(iteration);
+    size_t part_bytes = m_part_size * m_inner_bytes;
+    for (size_t i = 0; i < m_outer_count; i++)
+    {
+        memcpy(part + i * part_bytes,
+               outer + (i * m_axis_length + first) * m_inner_bytes,
+               part_bytes);
+    }
+}
+
+void runtime::TensorIteratorRunner::AxisSlicing::scatter(const char* part,
+                                                         char* outer,
+                                                         int64_t iteration) const
+{
+    size_t first = get_part_offset(iteration);
+    size_t part_bytes = m_part_size * m_inner_bytes;
+    for (size_t i = 0; i < m_outer_count; i++)
+    {
+        memcpy(outer + (i * m_axis_length + first) * m_inner_bytes,
+               part + i * part_bytes,
+               part_bytes);
+    }
+}
+
+runtime::TensorIteratorRunner::TensorIteratorRunner(const op::TensorIterator& ti,
+                                                    const shared_ptr<Backend>& backend)
+    : m_backend(backend)
+    , m_num_iterations(ti.get_num_iterations())
+{
+    NGRAPH_CHECK(m_num_iterations >= 0,
+                 "Number of iterations of ",
+                 ti.get_name(),
+                 " is not known at compile time");
+
+    // Compile a copy so backend passes don't rewrite the body shared with the op
+    auto body = ti.get_body();
+    auto function = clone_function(Function(body->get_results(), body->get_parameters()));
+    for (auto& parameter : function->get_parameters())
+    {
+        m_parameter_types.push_back(parameter->get_element_type());
+        m_parameter_shapes.push_back(parameter->get_shape());
+    }
+    for (auto& result : function->get_results())
+    {
+        m_result_types.push_back(result->get_element_type());
+        m_result_shapes.push_back(result->get_shape());
+    }
+    m_body = m_backend->compile(function);
+
+    for (auto& description : ti.get_input_descriptions())
+    {
+        size_t input_index = description->m_input_index;
+        size_t parameter_index = description->m_body_parameter_index;
+        if (auto slice = as_type_ptr<op::TensorIterator::SliceInputDescription>(description))
+        {
+            SlicedInput input;
+            input.m_input_index = input_index;
+            input.m_parameter_index = parameter_index;
+            input.m_slicing = AxisSlicing(ti.get_input_shape(input_index),
+                                          ti.get_input_element_type(input_index).size(),
+                                          slice->m_start,
+                                          slice->m_stride,
+                                          slice->m_part_size,
+                                          slice->m_axis);
+            if (!input.m_slicing.is_contiguous())
+            {
+                input.m_part = make_shared<AlignedBuffer>(
+                    shape_size(m_parameter_shapes[parameter_index]) *
+                    m_parameter_types[parameter_index].size());
+            }
+            m_sliced_inputs.push_back(input);
+        }
+        else if (auto merged = as_type_ptr<op::TensorIterator::MergedInputDescription>(description))
+        {
+            m_merged_inputs.push_back({input_index, parameter_index, merged->m_body_value_index});
+        }
+        else
+        {
+            m_invariant_inputs.push_back({input_index, parameter_index});
+        }
+    }
+
+    vector<size_t> consumers(m_result_types.size(), 0);
+    for (auto& description : ti.get_output_descriptions())
+    {
+        size_t output_index = description->m_output_index;
+        size_t result_index = description->m_body_value_index;
+        consumers[result_index]++;
+        if (auto concat = as_type_ptr<op::TensorIterator::ConcatOutputDescription>(description))
+        {
+            m_concat_outputs.push_back({output_index,
+                                        result_index,
+                                        AxisSlicing(ti.get_output_shape(output_index),
+                                                    ti.get_output_element_type(output_index).size(),
+                                                    concat->m_start,
+                                                    concat->m_stride,
+                                                    concat->m_part_size,
+                                                    concat->m_axis)});
+        }
+        else if (auto iteration =
+                     as_type_ptr<op::TensorIterator::BodyOutputDescription>(description))
+        {
+            int64_t n = iteration->m_iteration;
+            m_iteration_outputs.push_back(
+                {output_index, result_index, n < 0 ? m_num_iterations + n : n});
+        }
+    }
+
+    m_result_bindings.assign(m_result_types.size(), ResultBinding::SCRATCH);
+    for (const MergedInput& input : m_merged_inputs)
+    {
+        m_result_bindings[input.m_result_index] = ResultBinding::MERGED;
+    }
+    for (const ConcatOutput& output : m_concat_outputs)
+    {
+        ResultBinding& binding = m_result_bindings[output.m_result_index];
+        if (binding == ResultBinding::SCRATCH && consumers[output.m_result_index] == 1 &&
+            output.m_slicing.is_contiguous())
+        {
+            binding = ResultBinding::CONCAT_VIEW;
+        }
+    }
+    for (const IterationOutput& output : m_iteration_outputs)
+    {
+        ResultBinding& binding = m_result_bindings[output.m_result_index];
+        if (binding == ResultBinding::SCRATCH && consumers[output.m_result_index] == 1)
+        {
+            binding = ResultBinding::ITERATION_VIEW;
+        }
+    }
+
+    m_merged_buffers.resize(m_result_types.size());
+    m_scratch_buffers.resize(m_result_types.size());
+    for (size_t i = 0; i < m_result_types.size(); i++)
+    {
+        size_t size = shape_size(m_result_shapes[i]) * m_result_types[i].size();
+        switch (m_result_bindings[i])
+        {
+        case ResultBinding::MERGED:
+            m_merged_buffers[i][0] = make_shared<AlignedBuffer>(size);
+            m_merged_buffers[i][1] = make_shared<AlignedBuffer>(size);
+            break;
+        case ResultBinding::ITERATION_VIEW:
+        case ResultBinding::SCRATCH:
+            m_scratch_buffers[i] = make_shared<AlignedBuffer>(size);
+            break;
+        case ResultBinding::CONCAT_VIEW: break;
+        }
+    }
+}
+
+runtime::TensorIteratorRunner::~TensorIteratorRunner()
+{
+    m_backend->remove_compiled_function(m_body);
+}
+
+shared_ptr<runtime::Tensor> runtime::TensorIteratorRunner::wrap(size_t parameter_index,
+                                                                void* data) const
+{
+    return m_backend->create_tensor(
+        m_parameter_types[parameter_index], m_parameter_shapes[parameter_index], data);
+}
+
+shared_ptr<runtime::Tensor> runtime::TensorIteratorRunner::wrap_result(size_t result_index,
+                                                                       void* data) const
+{
+    return m_backend->create_tensor(
+        m_result_types[result_index], m_result_shapes[result_index], data);
+}
+
+void runtime::TensorIteratorRunner::run(const vector<void*>& inputs, const vector<void*>& outputs)
+{
+    lock_guard<mutex> lock(m_mutex);
+
+    vector<shared_ptr<Tensor>> parameters(m_parameter_types.size());
+    vector<shared_ptr<Tensor>> results(m_result_types.size());
+    vector<char*> result_data(m_result_types.size());
+
+    // Tensors over memory that doesn't move between iterations are created once
+    for (const InvariantInput& input : m_invariant_inputs)
+    {
+        parameters[input.m_parameter_index] =
+            wrap(input.m_parameter_index, inputs.at(input.m_input_index));
+    }
+    for (const SlicedInput& input : m_sliced_inputs)
+    {
+        if (!input.m_slicing.is_contiguous())
+        {
+            parameters[input.m_parameter_index] =
+                wrap(input.m_parameter_index, input.m_part->get_ptr());
+        }
+    }
+    vector<array<shared_ptr<Tensor>, 2>> merged_tensors(m_result_types.size());
+    vector<shared_ptr<Tensor>> scratch_tensors(m_result_types.size());
+    for (size_t i = 0; i < m_result_types.size(); i++)
+    {
+        if (m_result_bindings[i] == ResultBinding::MERGED)
+        {
+            merged_tensors[i][0] = wrap_result(i, m_merged_buffers[i][0]->get_ptr());
+            merged_tensors[i][1] = wrap_result(i, m_merged_buffers[i][1]->get_ptr());
+        }
+        else if (m_scratch_buffers[i])
+        {
+            scratch_tensors[i] = wrap_result(i, m_scratch_buffers[i]->get_ptr());
+            results[i] = scratch_tensors[i];
+            result_data[i] = m_scratch_buffers[i]->get_ptr<char>();
+        }
+    }
+
+    for (int64_t iteration = 0; iteration < m_num_iterations; iteration++)
+    {
+        for (const SlicedInput& input : m_sliced_inputs)
+        {
+            const AxisSlicing& slicing = input.m_slicing;
+            char* data = static_cast<char*>(inputs.at(input.m_input_index));
+            if (slicing.is_contiguous())
+            {
+                parameters[input.m_parameter_index] =
+                    wrap(input.m_parameter_index,
+                         data + slicing.get_part_offset(iteration) * slicing.m_inner_bytes);
+            }
+            else
+            {
+                slicing.gather(data, input.m_part->get_ptr<char>(), iteration);
+            }
+        }
+        for (const MergedInput& input : m_merged_inputs)
+        {
+            parameters[input.m_parameter_index] =
+                iteration == 0 ? wrap(input.m_parameter_index, inputs.at(input.m_input_index))
+                               : merged_tensors[input.m_result_index][(iteration - 1) % 2];
+        }
+
+        for (size_t i = 0; i < m_result_types.size(); i++)
+        {
+            if (m_result_bindings[i] == ResultBinding::MERGED)
+            {
+                results[i] = merged_tensors[i][iteration % 2];
+                result_data[i] = m_merged_buffers[i][iteration % 2]->get_ptr<char>();
+            }
+        }
+        for (const ConcatOutput& output : m_concat_outputs)
+        {
+            if (m_result_bindings[output.m_result_index] == ResultBinding::CONCAT_VIEW)
+            {
+                const AxisSlicing& slicing = output.m_slicing;
+                char* data = static_cast<char*>(outputs.at(output.m_output_index)) +
+                             slicing.get_part_offset(iteration) * slicing.m_inner_bytes;
+                results[output.m_result_index] = wrap_result(output.m_result_index, data);
+            }
+        }
+        for (const IterationOutput& output : m_iteration_outputs)
+        {
+            if (m_result_bindings[output.m_result_index] == ResultBinding::ITERATION_VIEW)
+            {
+                results[output.m_result_index] =
+                    iteration == output.m_iteration
+                        ? wrap_result(output.m_result_index, outputs.at(output.m_output_index))
+                        : scratch_tensors[output.m_result_index];
+            }
+        }
+
+        m_body->call(results, parameters);
+
+        for (const ConcatOutput& output : m_concat_outputs)
+        {
+            if (m_result_bindings[output.m_result_index] != ResultBinding::CONCAT_VIEW)
+            {
+                output.m_slicing.scatter(result_data[output.m_result_index],
+                                         static_cast<char*>(outputs.at(output.m_output_index)),
+                                         iteration);
+            }
+        }
+        for (const IterationOutput& output : m_iteration_outputs)
+        {
+            if (m_result_bindings[output.m_result_index] != ResultBinding::ITERATION_VIEW &&
+                iteration == output.m_iteration)
+            {
+                size_t result_index = output.m_result_index;
+                memcpy(outputs.at(output.m_output_index),
+                       result_data[result_index],
+                       shape_size(m_result_shapes[result_index]) *
+                           m_result_types[result_index].size());
+            }
+        }
+    }
+}
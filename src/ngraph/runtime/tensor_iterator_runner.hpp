@@ -0,0 +1,158 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <array>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "ngraph/op/tensor_iterator.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/executable.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        class TensorIteratorRunner;
+    }
+}
+
+/// \brief Executes an op::TensorIterator as a loop around a single executable compiled from
+///        its body.
+///
+/// Sliced inputs and concatenated outputs are bound as views into the outer tensors when the
+/// slice is contiguous in memory, which is the case when every axis before the sliced axis has
+/// length 1, and are gathered or scattered otherwise. The body value feeding a merged input is
+/// written into one of two buffers while the other holds the previous iteration's value, so
+/// back-edges never need a copy.
+class NGRAPH_API ngraph::runtime::TensorIteratorRunner
+{
+public:
+    /// \param ti The TensorIterator to run. Its shapes and number of iterations must be static.
+    /// \param backend Backend used to compile the body and to wrap outer memory as tensors. It
+    ///        may be shared between runners, each releases its body from the backend when
+    ///        destroyed.
+    TensorIteratorRunner(const op::TensorIterator& ti, const std::shared_ptr<Backend>& backend);
+    ~TensorIteratorRunner();
+
+    /// \brief Runs all iterations.
+    /// \param inputs Data of the TensorIterator inputs, in input order
+    /// \param outputs Data of the TensorIterator outputs, in output order
+    void run(const std::vector<void*>& inputs, const std::vector<void*>& outputs);
+
+private:
+    // Location of the part of an outer tensor a given iteration reads or writes
+    struct AxisSlicing
+    {
+        AxisSlicing() = default;
+        AxisSlicing(const Shape& shape,
+                    size_t element_size,
+                    int64_t start,
+                    int64_t stride,
+                    int64_t part_size,
+                    int64_t axis);
+
+        bool is_contiguous() const { return m_outer_count == 1; }
+        size_t get_part_offset(int64_t iteration) const;
+        void gather(const char* outer, char* part, int64_t iteration) const;
+        void scatter(const char* part, char* outer, int64_t iteration) const;
+
+        size_t m_outer_count = 1;
+        size_t m_axis_length = 0;
+        size_t m_inner_bytes = 0;
+        size_t m_part_size = 0;
+        int64_t m_start = 0;
+        int64_t m_stride = 0;
+    };
+
+    struct SlicedInput
+    {
+        size_t m_input_index;
+        size_t m_parameter_index;
+        AxisSlicing m_slicing;
+        std::shared_ptr<AlignedBuffer> m_part;
+    };
+
+    struct MergedInput
+    {
+        size_t m_input_index;
+        size_t m_parameter_index;
+        size_t m_result_index;
+    };
+
+    struct InvariantInput
+    {
+        size_t m_input_index;
+        size_t m_parameter_index;
+    };
+
+    struct ConcatOutput
+    {
+        size_t m_output_index;
+        size_t m_result_index;
+        AxisSlicing m_slicing;
+    };
+
+    struct IterationOutput
+    {
+        size_t m_output_index;
+        size_t m_result_index;
+        int64_t m_iteration;
+    };
+
+    // How a body result is bound during an iteration
+    enum class ResultBinding
+    {
+        // Written to the merged input buffers
+        MERGED,
+        // Written straight into the slice of its concatenated output
+        CONCAT_VIEW,
+        // Written straight into its output on the iteration that supplies it and to a scratch
+        // buffer on all others
+        ITERATION_VIEW,
+        // Written to a scratch buffer and copied out
+        SCRATCH
+    };
+
+    std::shared_ptr<Tensor> wrap(size_t parameter_index, void* data) const;
+    std::shared_ptr<Tensor> wrap_result(size_t result_index, void* data) const;
+
+    std::shared_ptr<Backend> m_backend;
+    std::shared_ptr<Executable> m_body;
+    int64_t m_num_iterations;
+
+    std::vector<element::Type> m_parameter_types;
+    std::vector<Shape> m_parameter_shapes;
+    std::vector<element::Type> m_result_types;
+    std::vector<Shape> m_result_shapes;
+
+    std::vector<SlicedInput> m_sliced_inputs;
+    std::vector<MergedInput> m_merged_inputs;
+    std::vector<InvariantInput> m_invariant_inputs;
+    std::vector<ConcatOutput> m_concat_outputs;
+    std::vector<IterationOutput> m_iteration_outputs;
+
+    std::vector<ResultBinding> m_result_bindings;
+    // Two buffers per MERGED result, the one written by iteration i is [i % 2]
+    std::vector<std::array<std::shared_ptr<AlignedBuffer>, 2>> m_merged_buffers;
+    std::vector<std::shared_ptr<AlignedBuffer>> m_scratch_buffers;
+
+    std::mutex m_mutex;
+};
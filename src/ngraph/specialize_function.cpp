@@ -16,11 +16,22 @@
 
 #include "ngraph/specialize_function.hpp"
 #include <pass/constant_folding.hpp>
+#include "ngraph/graph_util.hpp"
 #include "ngraph/op/constant.hpp"
 #include "ngraph/op/tensor_iterator.hpp"
 
 using namespace ngraph;
 
+// Most nodes have no runtime info; reading it through a const node avoids allocating an empty
+// copy on both nodes.
+static void copy_rt_info(const Node& from, Node& to)
+{
+    if (!from.get_rt_info().empty())
+    {
+        to.get_rt_info() = from.get_rt_info();
+    }
+}
+
 std::shared_ptr<Function>
     ngraph::specialize_function(std::shared_ptr<Function> f,
                                 const std::vector<element::Type>& parameter_element_types,
@@ -44,6 +55,8 @@ std::shared_ptr<Function>
     NGRAPH_CHECK(f->get_parameters().size() == parameter_values.size());
 
     NodeMap m;
+    auto ordered_ops = f->get_ordered_ops();
+    m.reserve(ordered_ops.size());
 
     for (size_t i = 0; i < parameter_shapes.size(); i++)
     {
@@ -61,10 +74,10 @@ std::shared_ptr<Function>
             m[f->get_parameters()[i].get()] =
                 std::make_shared<op::Parameter>(parameter_element_types[i], parameter_shapes[i]);
         }
-        m[f->get_parameters()[i].get()]->get_rt_info() = f->get_parameters()[i]->get_rt_info();
+        copy_rt_info(*f->get_parameters()[i], *m[f->get_parameters()[i].get()]);
     }
 
-    for (auto old_node : f->get_ordered_ops())
+    for (auto& old_node : ordered_ops)
     {
         if (old_node->is_parameter())
         {
@@ -86,11 +99,12 @@ std::shared_ptr<Function>
         {
             m[old_node.get()] = old_node->copy_with_new_inputs(new_args);
             //  TODO: workaround for shape inference, delete it after fix
-            if (::ngraph::as_type_ptr<ngraph::op::TensorIterator>(m[old_node.get()]))
+            if (::ngraph::as_type_ptr<ngraph::op::TensorIterator>(m[old_node.get()]) ||
+                !is_validated_copy(*old_node, *m[old_node.get()]))
             {
                 m[old_node.get()]->validate_and_infer_types();
             }
-            m[old_node.get()]->get_rt_info() = old_node->get_rt_info();
+            copy_rt_info(*old_node, *m[old_node.get()]);
         }
 
         m[old_node.get()]->set_friendly_name(old_node->get_friendly_name());
@@ -121,7 +135,8 @@ std::shared_ptr<Function>
         new_results[i]->set_friendly_name(name);
     }
 
-    auto function = std::make_shared<Function>(new_results, new_parameters);
+    // Every node was validated against its specialized inputs when it was copied
+    auto function = std::make_shared<Function>(new_results, new_parameters, "", false);
     if (constant_folding)
     {
         ngraph::pass::ConstantFolding().run_on_function(function);
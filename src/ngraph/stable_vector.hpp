@@ -0,0 +1,196 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace ngraph
+{
+    /// \brief Append-only sequence whose elements never move once constructed.
+    ///
+    /// The first N elements live inside the object itself; further elements go to a deque that
+    /// is only allocated when needed. Node uses this for its input and output descriptors, which
+    /// are referenced by address and almost always few in number, so most nodes need no heap
+    /// allocation for them (an empty std::deque already allocates over 500 bytes).
+    template <typename T, size_t N>
+    class StableVector
+    {
+    public:
+        template <typename V, typename Container>
+        class Iterator
+        {
+        public:
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type = typename std::remove_const<V>::type;
+            using difference_type = std::ptrdiff_t;
+            using pointer = V*;
+            using reference = V&;
+
+            Iterator(Container* container, size_t index)
+                : m_container(container)
+                , m_index(index)
+            {
+            }
+            V& operator*() const { return (*m_container)[m_index]; }
+            V* operator->() const { return &(*m_container)[m_index]; }
+            V& operator[](std::ptrdiff_t n) const { return (*m_container)[m_index + n]; }
+            Iterator& operator++()
+            {
+                ++m_index;
+                return *this;
+            }
+            Iterator operator++(int)
+            {
+                Iterator result = *this;
+                ++m_index;
+                return result;
+            }
+            Iterator& operator--()
+            {
+                --m_index;
+                return *this;
+            }
+            Iterator operator--(int)
+            {
+                Iterator result = *this;
+                --m_index;
+                return result;
+            }
+            Iterator& operator+=(std::ptrdiff_t n)
+            {
+                m_index += n;
+                return *this;
+            }
+            Iterator& operator-=(std::ptrdiff_t n)
+            {
+                m_index -= n;
+                return *this;
+            }
+            Iterator operator+(std::ptrdiff_t n) const
+            {
+                return Iterator(m_container, m_index + n);
+            }
+            Iterator operator-(std::ptrdiff_t n) const
+            {
+                return Iterator(m_container, m_index - n);
+            }
+            std::ptrdiff_t operator-(const Iterator& other) const
+            {
+                return static_cast<std::ptrdiff_t>(m_index) -
+                       static_cast<std::ptrdiff_t>(other.m_index);
+            }
+            bool operator==(const Iterator& other) const { return m_index == other.m_index; }
+            bool operator!=(const Iterator& other) const { return m_index != other.m_index; }
+            bool operator<(const Iterator& other) const { return m_index < other.m_index; }
+            bool operator>(const Iterator& other) const { return m_index > other.m_index; }
+            bool operator<=(const Iterator& other) const { return m_index <= other.m_index; }
+            bool operator>=(const Iterator& other) const { return m_index >= other.m_index; }
+
+        private:
+            Container* m_container;
+            size_t m_index;
+        };
+
+        using value_type = T;
+        using size_type = size_t;
+        using reference = T&;
+        using const_reference = const T&;
+        using iterator = Iterator<T, StableVector>;
+        using const_iterator = Iterator<const T, const StableVector>;
+
+        StableVector() = default;
+        StableVector(const StableVector&) = delete;
+        StableVector& operator=(const StableVector&) = delete;
+        ~StableVector() { clear(); }
+        size_t size() const { return m_size; }
+        bool empty() const { return m_size == 0; }
+        T& operator[](size_t i) { return i < N ? inline_element(i) : (*m_overflow)[i - N]; }
+        const T& operator[](size_t i) const
+        {
+            return i < N ? inline_element(i) : (*m_overflow)[i - N];
+        }
+        T& at(size_t i)
+        {
+            check_index(i);
+            return (*this)[i];
+        }
+        const T& at(size_t i) const
+        {
+            check_index(i);
+            return (*this)[i];
+        }
+        T& front() { return (*this)[0]; }
+        const T& front() const { return (*this)[0]; }
+        T& back() { return (*this)[m_size - 1]; }
+        const T& back() const { return (*this)[m_size - 1]; }
+        iterator begin() { return iterator(this, 0); }
+        iterator end() { return iterator(this, m_size); }
+        const_iterator begin() const { return const_iterator(this, 0); }
+        const_iterator end() const { return const_iterator(this, m_size); }
+        template <typename... Args>
+        T& emplace_back(Args&&... args)
+        {
+            if (m_size < N)
+            {
+                new (&m_inline[m_size]) T(std::forward<Args>(args)...);
+            }
+            else
+            {
+                if (!m_overflow)
+                {
+                    m_overflow.reset(new std::deque<T>());
+                }
+                m_overflow->emplace_back(std::forward<Args>(args)...);
+            }
+            return (*this)[m_size++];
+        }
+        void clear()
+        {
+            m_overflow.reset();
+            for (size_t i = m_size < N ? m_size : N; i > 0; --i)
+            {
+                inline_element(i - 1).~T();
+            }
+            m_size = 0;
+        }
+
+    private:
+        T& inline_element(size_t i) { return *reinterpret_cast<T*>(&m_inline[i]); }
+        const T& inline_element(size_t i) const
+        {
+            return *reinterpret_cast<const T*>(&m_inline[i]);
+        }
+        void check_index(size_t i) const
+        {
+            if (i >= m_size)
+            {
+                throw std::out_of_range("StableVector index out of range");
+            }
+        }
+
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type m_inline[N];
+        size_t m_size{0};
+        std::unique_ptr<std::deque<T>> m_overflow;
+    };
+}
@@ -35,6 +35,10 @@
 #include <iostream>
 #include <limits>
 
+#if defined(__AVX512F__) || defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
 #include "ngraph/type/bfloat16.hpp"
 
 using namespace std;
@@ -49,19 +53,73 @@ bool float_isnan(const float& x)
 
 std::vector<float> bfloat16::to_float_vector(const std::vector<bfloat16>& v_bf16)
 {
-    std::vector<float> v_f32(v_bf16.begin(), v_bf16.end());
+    std::vector<float> v_f32(v_bf16.size());
+    to_float(v_bf16.data(), v_f32.data(), v_bf16.size());
     return v_f32;
 }
 
 std::vector<bfloat16> bfloat16::from_float_vector(const std::vector<float>& v_f32)
 {
-    std::vector<bfloat16> v_bf16;
-    v_bf16.reserve(v_f32.size());
-    for (float a : v_f32)
+    std::vector<bfloat16> v_bf16(v_f32.size());
+    from_float(v_f32.data(), v_bf16.data(), v_f32.size());
+    return v_bf16;
+}
+
+void bfloat16::to_float(const bfloat16* in, float* out, size_t count)
+{
+    size_t i = 0;
+#if defined(__AVX512F__)
+    for (; i + 16 <= count; i += 16)
     {
-        v_bf16.push_back(static_cast<bfloat16>(a));
+        __m256i h = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+        _mm512_storeu_si512(out + i, _mm512_slli_epi32(_mm512_cvtepu16_epi32(h), 16));
+    }
+#elif defined(__AVX2__)
+    for (; i + 8 <= count; i += 8)
+    {
+        __m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i),
+                            _mm256_slli_epi32(_mm256_cvtepu16_epi32(h), 16));
+    }
+#endif
+    for (; i < count; ++i)
+    {
+        out[i] = static_cast<float>(in[i]);
+    }
+}
+
+void bfloat16::from_float(const float* in, bfloat16* out, size_t count)
+{
+    size_t i = 0;
+// The vector loops implement round_to_nearest_even, other modes use the scalar loop
+#if defined(ROUND_MODE_TO_NEAREST_EVEN) && defined(__AVX512F__)
+    const __m512i odd = _mm512_set1_epi32(0x00010000);
+    for (; i + 16 <= count; i += 16)
+    {
+        __m512i x = _mm512_loadu_si512(in + i);
+        __m512i bias = _mm512_srli_epi32(_mm512_and_si512(x, odd), 1);
+        __m512i rounded = _mm512_srli_epi32(_mm512_add_epi32(x, bias), 16);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm512_cvtepi32_epi16(rounded));
+    }
+#elif defined(ROUND_MODE_TO_NEAREST_EVEN) && defined(__AVX2__)
+    const __m256i odd = _mm256_set1_epi32(0x00010000);
+    for (; i + 16 <= count; i += 16)
+    {
+        __m256i lo = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+        __m256i hi = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i + 8));
+        lo = _mm256_add_epi32(lo, _mm256_srli_epi32(_mm256_and_si256(lo, odd), 1));
+        hi = _mm256_add_epi32(hi, _mm256_srli_epi32(_mm256_and_si256(hi, odd), 1));
+        // packus interleaves 128 bit lanes, the permute puts them back in order
+        __m256i packed =
+            _mm256_packus_epi32(_mm256_srli_epi32(lo, 16), _mm256_srli_epi32(hi, 16));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i),
+                            _mm256_permute4x64_epi64(packed, 0xD8));
+    }
+#endif
+    for (; i < count; ++i)
+    {
+        out[i] = bfloat16(in[i]);
     }
-    return v_bf16;
 }
 
 std::string bfloat16::to_string() const
@@ -106,13 +164,6 @@ bool bfloat16::operator>=(const bfloat16& other) const
     return (static_cast<float>(*this) >= static_cast<float>(other));
 }
 
-bfloat16::operator float() const
-{
-    uint32_t tmp = (static_cast<uint32_t>(m_value) << 16);
-    const float* f = reinterpret_cast<const float*>(&tmp);
-    return *f;
-}
-
 uint16_t bfloat16::to_bits() const
 {
     return m_value;
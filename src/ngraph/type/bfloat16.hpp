@@ -17,6 +17,7 @@
 #pragma once
 
 #include <cmath>
+#include <cstring>
 #include <iostream>
 #include <limits>
 #include <memory>
@@ -61,10 +62,20 @@ namespace ngraph
         bool operator<=(const bfloat16& other) const;
         bool operator>(const bfloat16& other) const;
         bool operator>=(const bfloat16& other) const;
-        operator float() const;
+        operator float() const
+        {
+            uint32_t bits = static_cast<uint32_t>(m_value) << 16;
+            float value;
+            std::memcpy(&value, &bits, sizeof(value));
+            return value;
+        }
 
         static std::vector<float> to_float_vector(const std::vector<bfloat16>&);
         static std::vector<bfloat16> from_float_vector(const std::vector<float>&);
+        /// \brief Converts count values, with AVX2/AVX-512 when the build targets them.
+        ///        Results are identical to converting one value at a time.
+        static void to_float(const bfloat16* in, float* out, size_t count);
+        static void from_float(const float* in, bfloat16* out, size_t count);
         static constexpr bfloat16 from_bits(uint16_t bits) { return bfloat16(bits, true); }
         uint16_t to_bits() const;
         friend std::ostream& operator<<(std::ostream& out, const bfloat16& obj)
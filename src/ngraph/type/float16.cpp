@@ -32,6 +32,7 @@
 //==============================================================================
 
 #include <cmath>
+#include <cstring>
 #include <iostream>
 #include <limits>
 
@@ -42,50 +43,93 @@ using namespace ngraph;
 
 static_assert(sizeof(float16) == 2, "class float16 must be exactly 2 bytes");
 
-float16::float16(float value)
+// Shared by the scalar and bulk conversions. Kept free of loops so the bulk conversions can
+// be vectorized.
+static inline uint16_t float_to_half_bits(float value)
 {
-    union {
-        float fv;
-        uint32_t iv;
-    };
-    fv = value;
+    uint32_t iv;
+    std::memcpy(&iv, &value, sizeof(iv));
     uint32_t hidden_one = 0x00800000;
-    uint32_t sign = iv & 0x80000000;
+    uint32_t sign = (iv & 0x80000000) >> 16;
     uint32_t biased_exp = (iv & 0x7F800000) >> 23;
     uint32_t raw_frac = (iv & 0x007FFFFF);
-    int32_t exp = biased_exp - 127;
-    int32_t min_exp = -14 - frac_size;
+    int32_t exp = static_cast<int32_t>(biased_exp) - 127;
+    int32_t min_exp = -14 - static_cast<int32_t>(float16::frac_size);
+    uint32_t bits;
     if (biased_exp == 0 || exp < min_exp)
     {
         // Goes to 0
-        biased_exp = 0;
+        bits = 0;
     }
     else if (biased_exp == 0xFF)
     {
         // Infinity or NAN.
-        biased_exp = 0x1F;
-        raw_frac = raw_frac >> (23 - frac_size);
+        bits = (0x1F << float16::frac_size) | (raw_frac >> (23 - float16::frac_size));
     }
     else if (exp < -14)
     {
         // denorm
-        biased_exp = 0;
+        uint32_t exp_shift = static_cast<uint32_t>(-14 - exp);
+        uint32_t shift = exp_shift + (23 - float16::frac_size);
         raw_frac |= hidden_one;
-        uint32_t exp_shift = (-15 - exp) + 1;
-        uint32_t shift = exp_shift + (23 - frac_size);
-        raw_frac = (raw_frac + (hidden_one >> (frac_size - exp_shift + 1))) >> shift;
+        bits = (raw_frac + (hidden_one >> (float16::frac_size - exp_shift + 1))) >> shift;
     }
     else if (exp > 15 || (exp == 15 && raw_frac > 0x7fef00 /* numpy overflow value */))
     {
-        biased_exp = 0x1F;
-        raw_frac = 0;
+        bits = 0x1F << float16::frac_size;
+    }
+    else
+    {
+        // Adding lets a fraction that rounds up to 0x400 carry into the exponent
+        bits = (static_cast<uint32_t>(exp + float16::exp_bias) << float16::frac_size) +
+               ((raw_frac + 0x1000) >> (23 - float16::frac_size));
+    }
+    return static_cast<uint16_t>(sign | bits);
+}
+
+static inline float half_bits_to_float(uint16_t value)
+{
+    uint32_t sign = static_cast<uint32_t>(value & 0x8000) << 16;
+    uint32_t exp = 0x1F & (value >> float16::frac_size);
+    uint32_t frac = value & 0x03FF;
+    uint32_t bits = sign | ((exp + 127 - 15) << 23) | (frac << (23 - float16::frac_size));
+    if (exp == 0x1F)
+    {
+        bits = sign | 0x7F800000 | (frac << (23 - float16::frac_size));
+    }
+    else if (exp == 0)
+    {
+        // Zero or denorm, frac * 2^-24 is exact in float
+        float denorm = static_cast<float>(frac) * 5.9604644775390625e-8f;
+        std::memcpy(&bits, &denorm, sizeof(bits));
+        bits |= sign;
+    }
+    float result;
+    std::memcpy(&result, &bits, sizeof(result));
+    return result;
+}
+
+float16::float16(float value)
+    : m_value(float_to_half_bits(value))
+{
+}
+
+void float16::to_float(const float16* in, float* out, size_t count)
+{
+    const uint16_t* bits = reinterpret_cast<const uint16_t*>(in);
+    for (size_t i = 0; i < count; ++i)
+    {
+        out[i] = half_bits_to_float(bits[i]);
     }
-    else if ((biased_exp != 0 || raw_frac != 0))
+}
+
+void float16::from_float(const float* in, float16* out, size_t count)
+{
+    uint16_t* bits = reinterpret_cast<uint16_t*>(out);
+    for (size_t i = 0; i < count; ++i)
     {
-        raw_frac = (raw_frac + 0x1000) >> (23 - frac_size);
-        biased_exp = exp + exp_bias;
+        bits[i] = float_to_half_bits(in[i]);
     }
-    m_value = (sign >> 16) | (biased_exp << frac_size) | raw_frac;
 }
 
 std::string float16::to_string() const
@@ -132,38 +176,7 @@ bool float16::operator>=(const float16& other) const
 
 float16::operator float() const
 {
-    union {
-        uint32_t i_val;
-        float f_val;
-    };
-    uint32_t exp = 0x1F & (m_value >> frac_size);
-    uint32_t fexp = exp + 127 - 15;
-    uint32_t frac = m_value & 0x03FF;
-    if (exp == 0)
-    {
-        if (frac == 0)
-        {
-            fexp = 0;
-        }
-        else
-        {
-            // Normalize
-            fexp++;
-            while (0 == (frac & 0x0400))
-            {
-                fexp--;
-                frac = frac << 1;
-            }
-            frac &= 0x03FF;
-        }
-    }
-    else if (exp == 0x1F)
-    {
-        fexp = 0xFF;
-    }
-    frac = frac << (23 - frac_size);
-    i_val = static_cast<uint32_t>((m_value & 0x8000)) << 16 | (fexp << 23) | frac;
-    return f_val;
+    return half_bits_to_float(m_value);
 }
 
 uint16_t float16::to_bits() const
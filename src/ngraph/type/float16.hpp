@@ -58,6 +58,11 @@ namespace ngraph
         bool operator>=(const float16& other) const;
         operator float() const;
 
+        /// \brief Converts count values in loops the compiler can vectorize. Results are
+        ///        identical to converting one value at a time.
+        static void to_float(const float16* in, float* out, size_t count);
+        static void from_float(const float* in, float16* out, size_t count);
+
         static constexpr float16 from_bits(uint16_t bits) { return float16(bits, true); }
         uint16_t to_bits() const;
         friend std::ostream& operator<<(std::ostream& out, const float16& obj)
@@ -31,7 +31,8 @@ vector<runtime::PerformanceCounter> run_benchmark(shared_ptr<Function> f,
                                                   size_t iterations,
                                                   bool timing_detail,
                                                   size_t warmup_iterations,
-                                                  bool copy_data)
+                                                  bool copy_data,
+                                                  double* iteration_ms)
 {
     stopwatch timer;
     timer.start();
@@ -113,6 +114,10 @@ vector<runtime::PerformanceCounter> run_benchmark(shared_ptr<Function> f,
     t1.stop();
     float time = t1.get_milliseconds();
     ss << time / iterations << "ms per iteration" << endl;
+    if (iteration_ms != nullptr)
+    {
+        *iteration_ms = time / iterations;
+    }
     cout << ss.str();
 
     vector<runtime::PerformanceCounter> perf_data = exec->get_performance_data();
@@ -14,7 +14,6 @@
 // limitations under the License.
 //*****************************************************************************
 
-#include <array>
 #include <condition_variable>
 #include <mutex>
 #include <thread>
@@ -46,6 +45,7 @@ private:
 static mutex s_mutex;
 static condition_variable s_condition;
 static size_t current_iteration = 0;
+static size_t s_pipeline_depth;
 static size_t s_iterations;
 static size_t s_warmup_iterations;
 static stopwatch s_timer;
@@ -73,7 +73,7 @@ static void
             data_written = true;
         }
         unique_lock<mutex> lock(s_mutex);
-        if ((current_iteration & 1) != pipeline_stage)
+        if ((current_iteration % s_pipeline_depth) != pipeline_stage)
         {
             s_condition.wait(lock);
         }
@@ -109,12 +109,19 @@ vector<runtime::PerformanceCounter> run_benchmark_pipelined(shared_ptr<Function>
                                                             size_t iterations,
                                                             bool timing_detail,
                                                             int warmup_iterations,
-                                                            bool /* copy_data */)
+                                                            bool /* copy_data */,
+                                                            size_t pipeline_depth,
+                                                            double* iteration_ms)
 {
-    constexpr size_t pipeline_depth = 2;
+    if (pipeline_depth == 0)
+    {
+        throw invalid_argument("pipeline depth must be at least 1");
+    }
+    current_iteration = 0;
+    s_pipeline_depth = pipeline_depth;
     s_iterations = iterations;
     s_warmup_iterations = warmup_iterations;
-    array<TensorCollection, pipeline_depth> tensor_collections;
+    vector<TensorCollection> tensor_collections(pipeline_depth);
     stopwatch timer;
     timer.start();
     auto backend = runtime::Backend::create(backend_name);
@@ -149,7 +156,6 @@ vector<runtime::PerformanceCounter> run_benchmark_pipelined(shared_ptr<Function>
     }
 
     // Create input tensors for all Parameters
-    array<vector<shared_ptr<runtime::Tensor>>, pipeline_depth> input_tensors_array;
     size_t input_index = 0;
     for (shared_ptr<op::Parameter> param : f->get_parameters())
     {
@@ -161,7 +167,6 @@ vector<runtime::PerformanceCounter> run_benchmark_pipelined(shared_ptr<Function>
     }
 
     // Create output tensors for all Results
-    array<vector<shared_ptr<runtime::Tensor>>, pipeline_depth> output_tensors_array;
     size_t output_index = 0;
     for (shared_ptr<Node> result : f->get_results())
     {
@@ -172,10 +177,10 @@ vector<runtime::PerformanceCounter> run_benchmark_pipelined(shared_ptr<Function>
         }
     }
 
-    thread threads[pipeline_depth];
+    vector<thread> threads;
     for (size_t i = 0; i < pipeline_depth; i++)
     {
-        threads[i] = thread(thread_entry, exec.get(), tensor_collections[i], i);
+        threads.push_back(thread(thread_entry, exec.get(), tensor_collections[i], i));
     }
 
     for (size_t i = 0; i < pipeline_depth; i++)
@@ -184,6 +189,10 @@ vector<runtime::PerformanceCounter> run_benchmark_pipelined(shared_ptr<Function>
     }
     float time = s_timer.get_milliseconds();
     ss << time / iterations << "ms per iteration" << endl;
+    if (iteration_ms != nullptr)
+    {
+        *iteration_ms = time / iterations;
+    }
     cout << ss.str();
 
     vector<runtime::PerformanceCounter> perf_data = exec->get_performance_data();
@@ -30,4 +30,6 @@ std::vector<ngraph::runtime::PerformanceCounter>
                             size_t iterations,
                             bool timing_detail,
                             int warmup_iterations,
-                            bool copy_data);
+                            bool copy_data,
+                            size_t pipeline_depth = 2,
+                            double* iteration_ms = nullptr);
@@ -0,0 +1,330 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <thread>
+#include <unordered_map>
+
+#include "benchmark_report.hpp"
+#include "ngraph/env_util.hpp"
+#include "ngraph/except.hpp"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/util.hpp"
+#include "nlohmann/json.hpp"
+
+using namespace std;
+using namespace ngraph;
+using json = nlohmann::json;
+
+void init_report(BenchmarkReport& report)
+{
+    report.build = get_ngraph_version_string();
+    report.hardware_threads = thread::hardware_concurrency();
+    report.omp_num_threads = getenv_string("OMP_NUM_THREADS");
+}
+
+vector<OpReport> make_op_reports(const vector<runtime::PerformanceCounter>& perf_data)
+{
+    vector<OpReport> ops;
+    for (const runtime::PerformanceCounter& p : perf_data)
+    {
+        OpReport op;
+        auto node = p.get_node();
+        op.name = node->get_friendly_name();
+        op.op = node->description();
+        // Left empty for ops without outputs or with a dynamic output shape
+        if (node->get_output_size() > 0 && node->get_output_partial_shape(0).is_static())
+        {
+            op.shape = "{" + join(node->get_output_shape(0)) + "}";
+        }
+        op.total_us = p.total_microseconds();
+        op.calls = p.call_count();
+        ops.push_back(op);
+    }
+    return ops;
+}
+
+static json write_streams(const StreamStatistics& s)
+{
+    json j;
+    j["streams"] = s.streams;
+    j["target_qps"] = s.target_qps;
+    j["requests"] = s.requests;
+    j["elapsed_ms"] = s.elapsed_ms;
+    j["throughput"] = s.throughput;
+    j["mean_ms"] = s.mean_ms;
+    j["p50_ms"] = s.p50_ms;
+    j["p95_ms"] = s.p95_ms;
+    j["p99_ms"] = s.p99_ms;
+    j["max_ms"] = s.max_ms;
+    return j;
+}
+
+static StreamStatistics read_streams(const json& j)
+{
+    StreamStatistics s;
+    s.streams = j.at("streams").get<size_t>();
+    s.target_qps = j.at("target_qps").get<double>();
+    s.requests = j.at("requests").get<size_t>();
+    s.elapsed_ms = j.at("elapsed_ms").get<double>();
+    s.throughput = j.at("throughput").get<double>();
+    s.mean_ms = j.at("mean_ms").get<double>();
+    s.p50_ms = j.at("p50_ms").get<double>();
+    s.p95_ms = j.at("p95_ms").get<double>();
+    s.p99_ms = j.at("p99_ms").get<double>();
+    s.max_ms = j.at("max_ms").get<double>();
+    return s;
+}
+
+void write_json_report(const string& path, const BenchmarkReport& report)
+{
+    json j;
+    j["backend"] = report.backend;
+    j["build"] = report.build;
+    j["iterations"] = report.iterations;
+    j["warmup_iterations"] = report.warmup_iterations;
+    j["hardware_threads"] = report.hardware_threads;
+    j["omp_num_threads"] = report.omp_num_threads;
+    json models = json::array();
+    for (const ModelReport& model : report.models)
+    {
+        json m;
+        m["model"] = model.model;
+        m["iteration_ms"] = model.iteration_ms;
+        if (model.has_streams)
+        {
+            m["streams"] = write_streams(model.streams);
+        }
+        json ops = json::array();
+        for (const OpReport& op : model.ops)
+        {
+            json o;
+            o["name"] = op.name;
+            o["op"] = op.op;
+            o["shape"] = op.shape;
+            o["total_us"] = op.total_us;
+            o["calls"] = op.calls;
+            ops.push_back(o);
+        }
+        m["ops"] = ops;
+        models.push_back(m);
+    }
+    j["models"] = models;
+
+    ofstream out(path);
+    if (!out)
+    {
+        throw ngraph_error("Failed to open '" + path + "' for writing");
+    }
+    out << setw(4) << j << endl;
+}
+
+static string csv_field(const string& s)
+{
+    if (s.find_first_of(",\"\n") == string::npos)
+    {
+        return s;
+    }
+    string rc = "\"";
+    for (char c : s)
+    {
+        if (c == '"')
+        {
+            rc += '"';
+        }
+        rc += c;
+    }
+    return rc + "\"";
+}
+
+void write_csv_report(const string& path, const BenchmarkReport& report)
+{
+    ofstream out(path);
+    if (!out)
+    {
+        throw ngraph_error("Failed to open '" + path + "' for writing");
+    }
+    out << "record,model,backend,build,hardware_threads,omp_num_threads,name,op,shape,calls,"
+           "total_us,us_per_call,iteration_ms,streams,throughput,p50_ms,p95_ms,p99_ms\n";
+    string common = csv_field(report.backend) + "," + csv_field(report.build) + "," +
+                    to_string(report.hardware_threads) + "," +
+                    csv_field(report.omp_num_threads);
+    for (const ModelReport& model : report.models)
+    {
+        out << "model," << csv_field(model.model) << "," << common << ",,,,,,,"
+            << model.iteration_ms << ",";
+        if (model.has_streams)
+        {
+            const StreamStatistics& s = model.streams;
+            out << s.streams << "," << s.throughput << "," << s.p50_ms << "," << s.p95_ms << ","
+                << s.p99_ms;
+        }
+        else
+        {
+            out << ",,,,";
+        }
+        out << "\n";
+        for (const OpReport& op : model.ops)
+        {
+            out << "op," << csv_field(model.model) << "," << common << "," << csv_field(op.name)
+                << "," << csv_field(op.op) << "," << csv_field(op.shape) << "," << op.calls
+                << "," << op.total_us << "," << (op.calls == 0 ? 0 : op.total_us / op.calls)
+                << ",,,,,,\n";
+        }
+    }
+}
+
+BenchmarkReport read_json_report(const string& path)
+{
+    ifstream in(path);
+    if (!in)
+    {
+        throw ngraph_error("Failed to open '" + path + "' for reading");
+    }
+    json j;
+    in >> j;
+
+    BenchmarkReport report;
+    report.backend = j.at("backend").get<string>();
+    report.build = j.at("build").get<string>();
+    report.iterations = j.at("iterations").get<size_t>();
+    report.warmup_iterations = j.at("warmup_iterations").get<size_t>();
+    report.hardware_threads = j.at("hardware_threads").get<unsigned>();
+    report.omp_num_threads = j.at("omp_num_threads").get<string>();
+    for (const json& m : j.at("models"))
+    {
+        ModelReport model;
+        model.model = m.at("model").get<string>();
+        model.iteration_ms = m.at("iteration_ms").get<double>();
+        if (m.count("streams") != 0)
+        {
+            model.has_streams = true;
+            model.streams = read_streams(m.at("streams"));
+        }
+        for (const json& o : m.at("ops"))
+        {
+            OpReport op;
+            op.name = o.at("name").get<string>();
+            op.op = o.at("op").get<string>();
+            op.shape = o.at("shape").get<string>();
+            op.total_us = o.at("total_us").get<size_t>();
+            op.calls = o.at("calls").get<size_t>();
+            model.ops.push_back(op);
+        }
+        report.models.push_back(model);
+    }
+    return report;
+}
+
+static double percent_change(double baseline, double current)
+{
+    return baseline == 0 ? 0 : (current - baseline) * 100.0 / baseline;
+}
+
+static void print_change(const string& name, double baseline, double current, bool regressed)
+{
+    cout << (regressed ? "REGRESSED " : "          ") << setw(40) << left << name << right
+         << setw(14) << baseline << setw(14) << current << setw(9) << fixed << setprecision(1)
+         << showpos << percent_change(baseline, current) << noshowpos << "%\n";
+    cout.unsetf(ios_base::floatfield);
+    cout << setprecision(6);
+}
+
+// Node names are assigned from a process-wide counter and differ between runs, so ops are
+// matched on their type, output shape and ordinal among ops of that type and shape.
+static vector<string> op_keys(const vector<OpReport>& ops)
+{
+    vector<string> keys;
+    unordered_map<string, size_t> seen;
+    for (const OpReport& op : ops)
+    {
+        string key = op.op + op.shape;
+        keys.push_back(key + "#" + to_string(seen[key]++));
+    }
+    return keys;
+}
+
+size_t compare_reports(const BenchmarkReport& baseline,
+                       const BenchmarkReport& current,
+                       double threshold_percent,
+                       size_t min_us)
+{
+    if (baseline.backend != current.backend)
+    {
+        cout << "WARNING: comparing backend '" << current.backend << "' against '"
+             << baseline.backend << "'\n";
+    }
+    cout << "baseline build: " << baseline.build << "\n";
+    cout << "current build:  " << current.build << "\n";
+    cout << "regression threshold: " << threshold_percent << "%\n";
+
+    size_t regressions = 0;
+    for (const ModelReport& model : current.models)
+    {
+        auto base_model =
+            find_if(baseline.models.begin(),
+                    baseline.models.end(),
+                    [&](const ModelReport& m) { return m.model == model.model; });
+        if (base_model == baseline.models.end())
+        {
+            cout << "\nModel '" << model.model << "' not in baseline\n";
+            continue;
+        }
+
+        cout << "\n---- " << model.model << " ----\n";
+        cout << "          " << setw(40) << left << "" << right << setw(14) << "baseline"
+             << setw(14) << "current" << setw(10) << "change" << "\n";
+        double limit = 1.0 + threshold_percent / 100.0;
+        bool regressed = model.iteration_ms > base_model->iteration_ms * limit;
+        regressions += regressed;
+        print_change("ms per iteration", base_model->iteration_ms, model.iteration_ms, regressed);
+        if (model.has_streams && base_model->has_streams)
+        {
+            regressed = model.streams.p99_ms > base_model->streams.p99_ms * limit;
+            regressions += regressed;
+            print_change(
+                "p99 latency ms", base_model->streams.p99_ms, model.streams.p99_ms, regressed);
+        }
+
+        unordered_map<string, const OpReport*> base_ops;
+        vector<string> base_keys = op_keys(base_model->ops);
+        for (size_t i = 0; i < base_keys.size(); i++)
+        {
+            base_ops[base_keys[i]] = &base_model->ops[i];
+        }
+        vector<string> keys = op_keys(model.ops);
+        for (size_t i = 0; i < keys.size(); i++)
+        {
+            const OpReport& op = model.ops[i];
+            auto it = base_ops.find(keys[i]);
+            if (it == base_ops.end() || it->second->calls == 0 || op.calls == 0)
+            {
+                continue;
+            }
+            double base_us = static_cast<double>(it->second->total_us) / it->second->calls;
+            double us = static_cast<double>(op.total_us) / op.calls;
+            if (base_us >= min_us && us > base_us * limit)
+            {
+                regressions++;
+                print_change(op.name + " (" + op.op + ")", base_us, us, true);
+            }
+        }
+    }
+    cout << "\n" << regressions << " regression" << (regressions == 1 ? "" : "s") << " found\n";
+    return regressions;
+}
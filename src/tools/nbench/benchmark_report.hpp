@@ -0,0 +1,80 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "benchmark_streams.hpp"
+#include "ngraph/runtime/performance_counter.hpp"
+
+/// \brief Timing of a single op within a benchmarked model.
+struct OpReport
+{
+    std::string name;
+    std::string op;
+    std::string shape;
+    size_t total_us = 0;
+    size_t calls = 0;
+};
+
+/// \brief Results of benchmarking one model, the unit written to and compared between
+///        result files.
+struct ModelReport
+{
+    std::string model;
+    double iteration_ms = 0;
+    bool has_streams = false;
+    StreamStatistics streams;
+    std::vector<OpReport> ops;
+};
+
+/// \brief Everything written to a result file, the models plus the environment they ran in.
+struct BenchmarkReport
+{
+    std::string backend;
+    std::string build;
+    size_t iterations = 0;
+    size_t warmup_iterations = 0;
+    unsigned hardware_threads = 0;
+    std::string omp_num_threads;
+    std::vector<ModelReport> models;
+};
+
+/// \brief Fill in build and thread information from the running process.
+void init_report(BenchmarkReport& report);
+
+std::vector<OpReport> make_op_reports(const std::vector<ngraph::runtime::PerformanceCounter>&);
+
+void write_json_report(const std::string& path, const BenchmarkReport& report);
+
+/// \brief Write one row per model and one row per op, distinguished by the `record` column.
+void write_csv_report(const std::string& path, const BenchmarkReport& report);
+
+BenchmarkReport read_json_report(const std::string& path);
+
+/// \brief Print per-model and per-op time differences between two reports.
+///
+/// Models are matched by file name and ops by type, output shape and ordinal among ops of the
+/// same type and shape. A model or op regresses when its time in `current` exceeds its time in
+/// `baseline` by more than `threshold_percent`. Ops whose baseline time per call is below
+/// `min_us` are not flagged, their timing is mostly noise.
+/// \return The number of regressions found.
+size_t compare_reports(const BenchmarkReport& baseline,
+                       const BenchmarkReport& current,
+                       double threshold_percent,
+                       size_t min_us);
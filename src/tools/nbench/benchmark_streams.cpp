@@ -0,0 +1,295 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include "benchmark_streams.hpp"
+#include "benchmark_utils.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/host_tensor.hpp"
+#include "ngraph/runtime/tensor.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+using request_clock = chrono::steady_clock;
+
+namespace
+{
+    class StreamClient
+    {
+    public:
+        vector<shared_ptr<runtime::HostTensor>> parameter_data;
+        vector<shared_ptr<runtime::HostTensor>> result_data;
+
+        vector<shared_ptr<runtime::Tensor>> input_tensors;
+        vector<shared_ptr<runtime::Tensor>> output_tensors;
+
+        shared_ptr<runtime::Executable> exec;
+        vector<double> latencies;
+    };
+
+    class StartGate
+    {
+    public:
+        StartGate(size_t count)
+            : m_waiting(count)
+        {
+        }
+
+        // Blocks until every client has arrived, the last one to arrive records the start time
+        request_clock::time_point arrive_and_wait()
+        {
+            unique_lock<mutex> lock(m_mutex);
+            if (--m_waiting == 0)
+            {
+                m_start = request_clock::now();
+                m_condition.notify_all();
+            }
+            else
+            {
+                m_condition.wait(lock, [this] { return m_waiting == 0; });
+            }
+            return m_start;
+        }
+
+        request_clock::time_point get_start() const { return m_start; }
+
+    private:
+        mutex m_mutex;
+        condition_variable m_condition;
+        size_t m_waiting;
+        request_clock::time_point m_start;
+    };
+}
+
+static void run_request(StreamClient& client, bool copy_data)
+{
+    if (copy_data)
+    {
+        for (size_t arg_index = 0; arg_index < client.input_tensors.size(); arg_index++)
+        {
+            const shared_ptr<runtime::Tensor>& arg = client.input_tensors[arg_index];
+            if (arg->get_stale())
+            {
+                const shared_ptr<runtime::HostTensor>& data = client.parameter_data[arg_index];
+                arg->write(data->get_data_ptr(),
+                           data->get_element_count() * data->get_element_type().size());
+            }
+        }
+    }
+    client.exec->call(client.output_tensors, client.input_tensors);
+    if (copy_data)
+    {
+        for (size_t result_index = 0; result_index < client.output_tensors.size(); result_index++)
+        {
+            const shared_ptr<runtime::HostTensor>& data = client.result_data[result_index];
+            const shared_ptr<runtime::Tensor>& result = client.output_tensors[result_index];
+            result->read(data->get_data_ptr(),
+                         data->get_element_count() * data->get_element_type().size());
+        }
+    }
+}
+
+// Nearest-rank percentile of an ascending sorted list
+static double percentile(const vector<double>& sorted, double p)
+{
+    if (sorted.empty())
+    {
+        return 0;
+    }
+    size_t rank = static_cast<size_t>(ceil(p / 100.0 * sorted.size()));
+    return sorted[rank == 0 ? 0 : rank - 1];
+}
+
+vector<runtime::PerformanceCounter> run_benchmark_streams(shared_ptr<Function> f,
+                                                          const string& backend_name,
+                                                          size_t iterations,
+                                                          bool timing_detail,
+                                                          size_t warmup_iterations,
+                                                          bool copy_data,
+                                                          size_t streams,
+                                                          double target_qps,
+                                                          StreamStatistics& statistics)
+{
+    if (streams == 0)
+    {
+        throw invalid_argument("stream count must be at least 1");
+    }
+    if (target_qps < 0)
+    {
+        throw invalid_argument("target QPS must not be negative");
+    }
+
+    // Executables are not required to be reentrant, so every client gets its own, compiled
+    // from its own copy of the function since backends may cache executables per function and
+    // modify the function while compiling
+    vector<shared_ptr<Function>> functions{f};
+    for (size_t i = 1; i < streams; i++)
+    {
+        functions.push_back(clone_function(*f));
+    }
+
+    stopwatch timer;
+    timer.start();
+    auto backend = runtime::Backend::create(backend_name);
+    vector<StreamClient> clients(streams);
+    for (size_t i = 0; i < streams; i++)
+    {
+        clients[i].exec = backend->compile(functions[i], timing_detail);
+    }
+    timer.stop();
+    stringstream ss;
+    ss.imbue(locale(""));
+    ss << "compile time: " << timer.get_milliseconds() << "ms" << endl;
+    set_denormals_flush_to_zero();
+
+    for (StreamClient& client : clients)
+    {
+        for (shared_ptr<op::Parameter> param : f->get_parameters())
+        {
+            auto tensor_data =
+                make_shared<runtime::HostTensor>(param->get_element_type(), param->get_shape());
+            random_init(tensor_data);
+            auto tensor = backend->create_tensor(param->get_element_type(), param->get_shape());
+            tensor->write(tensor_data->get_data_ptr(),
+                          tensor_data->get_element_count() *
+                              tensor_data->get_element_type().size());
+            if (param->get_cacheable())
+            {
+                tensor->set_stale(false);
+            }
+            client.parameter_data.push_back(tensor_data);
+            client.input_tensors.push_back(tensor);
+        }
+        for (shared_ptr<Node> result : f->get_results())
+        {
+            client.result_data.push_back(
+                make_shared<runtime::HostTensor>(result->get_element_type(), result->get_shape()));
+            client.output_tensors.push_back(
+                backend->create_tensor(result->get_element_type(), result->get_shape()));
+        }
+        client.latencies.reserve(iterations / streams + 1);
+    }
+
+    // Requests are handed out from a shared counter. In open loop mode request n is due at
+    // start + n / target_qps, a client that picks it up early sleeps until it is due.
+    atomic<size_t> next_request{0};
+    StartGate gate(streams);
+    chrono::duration<double> request_interval(target_qps > 0 ? 1.0 / target_qps : 0.0);
+    auto client_entry = [&](StreamClient& client) {
+        for (size_t i = 0; i < warmup_iterations; i++)
+        {
+            run_request(client, copy_data);
+        }
+        request_clock::time_point start = gate.arrive_and_wait();
+        for (size_t request = next_request++; request < iterations; request = next_request++)
+        {
+            request_clock::time_point arrival = request_clock::now();
+            if (target_qps > 0)
+            {
+                arrival = start + chrono::duration_cast<request_clock::duration>(
+                                      request_interval * static_cast<double>(request));
+                this_thread::sleep_until(arrival);
+            }
+            run_request(client, copy_data);
+            chrono::duration<double, milli> latency = request_clock::now() - arrival;
+            client.latencies.push_back(latency.count());
+        }
+    };
+
+    vector<thread> threads;
+    for (StreamClient& client : clients)
+    {
+        threads.push_back(thread(client_entry, ref(client)));
+    }
+    for (thread& t : threads)
+    {
+        t.join();
+    }
+    chrono::duration<double, milli> elapsed = request_clock::now() - gate.get_start();
+
+    vector<double> latencies;
+    for (const StreamClient& client : clients)
+    {
+        latencies.insert(latencies.end(), client.latencies.begin(), client.latencies.end());
+    }
+    sort(latencies.begin(), latencies.end());
+
+    statistics = StreamStatistics();
+    statistics.streams = streams;
+    statistics.target_qps = target_qps;
+    statistics.requests = latencies.size();
+    statistics.elapsed_ms = elapsed.count();
+    if (statistics.elapsed_ms > 0)
+    {
+        statistics.throughput = statistics.requests * 1000.0 / statistics.elapsed_ms;
+    }
+    if (!latencies.empty())
+    {
+        double total = 0;
+        for (double latency : latencies)
+        {
+            total += latency;
+        }
+        statistics.mean_ms = total / latencies.size();
+        statistics.p50_ms = percentile(latencies, 50);
+        statistics.p95_ms = percentile(latencies, 95);
+        statistics.p99_ms = percentile(latencies, 99);
+        statistics.max_ms = latencies.back();
+    }
+
+    ss << streams << " streams, " << statistics.requests << " requests in "
+       << statistics.elapsed_ms << "ms" << endl;
+    ss << "throughput: " << statistics.throughput << " requests/s";
+    if (target_qps > 0)
+    {
+        ss << " (target " << target_qps << ")";
+    }
+    ss << endl;
+    ss << "latency: mean " << statistics.mean_ms << "ms, p50 " << statistics.p50_ms << "ms, p95 "
+       << statistics.p95_ms << "ms, p99 " << statistics.p99_ms << "ms, max " << statistics.max_ms
+       << "ms" << endl;
+    cout << ss.str();
+
+    // The executables were compiled from copies of one function, so their counters line up op
+    // for op and are summed into the first client's
+    vector<runtime::PerformanceCounter> perf_data = clients[0].exec->get_performance_data();
+    for (size_t i = 1; i < streams; i++)
+    {
+        vector<runtime::PerformanceCounter> stream_perf = clients[i].exec->get_performance_data();
+        if (stream_perf.size() != perf_data.size())
+        {
+            continue;
+        }
+        for (size_t j = 0; j < perf_data.size(); j++)
+        {
+            perf_data[j] = runtime::PerformanceCounter(
+                perf_data[j].get_node(),
+                perf_data[j].total_microseconds() + stream_perf[j].total_microseconds(),
+                perf_data[j].call_count() + stream_perf[j].call_count());
+        }
+    }
+    return perf_data;
+}
@@ -0,0 +1,60 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ngraph/function.hpp"
+#include "ngraph/runtime/performance_counter.hpp"
+
+/// \brief Request level statistics gathered by run_benchmark_streams.
+struct StreamStatistics
+{
+    size_t streams = 0;
+    double target_qps = 0;
+    size_t requests = 0;
+    double elapsed_ms = 0;
+    double throughput = 0;
+    double mean_ms = 0;
+    double p50_ms = 0;
+    double p95_ms = 0;
+    double p99_ms = 0;
+    double max_ms = 0;
+};
+
+/// \brief Benchmark a Function the way a server sees it.
+///
+/// `streams` client threads each run their own compiled Executable with their own input and
+/// output tensors, since executables are not required to be reentrant. With a `target_qps` of
+/// zero each client issues its next request as soon as the previous one returns (closed loop).
+/// Otherwise requests are scheduled at a fixed rate of `target_qps` regardless of completions
+/// (open loop) and latency is measured from the scheduled arrival, so time spent waiting for a
+/// free client counts against the request. `iterations` is the total number of timed requests
+/// across all clients. Each client runs `warmup_iterations` untimed requests before timing
+/// starts.
+std::vector<ngraph::runtime::PerformanceCounter>
+    run_benchmark_streams(std::shared_ptr<ngraph::Function> f,
+                          const std::string& backend_name,
+                          size_t iterations,
+                          bool timing_detail,
+                          size_t warmup_iterations,
+                          bool copy_data,
+                          size_t streams,
+                          double target_qps,
+                          StreamStatistics& statistics);
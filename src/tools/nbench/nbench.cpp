@@ -30,6 +30,8 @@
 
 #include "benchmark.hpp"
 #include "benchmark_pipelined.hpp"
+#include "benchmark_report.hpp"
+#include "benchmark_streams.hpp"
 #include "ngraph/component_manager.hpp"
 #include "ngraph/distributed.hpp"
 #include "ngraph/except.hpp"
@@ -172,6 +174,25 @@ void print_results(vector<PerfShape> perf_data, bool timing_detail)
     }
 }
 
+void print_stream_summary(const vector<pair<string, StreamStatistics>>& stream_results)
+{
+    size_t name_width = 5;
+    for (auto& result : stream_results)
+    {
+        name_width = max(name_width, result.first.size());
+    }
+    cout << setw(name_width + 2) << left << "model" << right << setw(8) << "streams"
+         << setw(12) << "target qps" << setw(12) << "qps" << setw(12) << "p50 ms" << setw(12)
+         << "p95 ms" << setw(12) << "p99 ms" << "\n";
+    for (auto& result : stream_results)
+    {
+        const StreamStatistics& s = result.second;
+        cout << setw(name_width + 2) << left << result.first << right << setw(8) << s.streams
+             << setw(12) << s.target_qps << setw(12) << s.throughput << setw(12) << s.p50_ms
+             << setw(12) << s.p95_ms << setw(12) << s.p99_ms << "\n";
+    }
+}
+
 int main(int argc, char** argv)
 {
     string model_arg;
@@ -186,6 +207,15 @@ int main(int argc, char** argv)
     bool copy_data = true;
     bool dot_file = false;
     bool double_buffer = false;
+    int pipeline_depth = 2;
+    int streams = 0;
+    double target_qps = 0;
+    string json_file;
+    string csv_file;
+    string compare_baseline;
+    string compare_current;
+    double threshold = 5;
+    int min_us = 10;
 
     configure_static_backends();
     for (int i = 1; i < argc; i++)
@@ -239,6 +269,80 @@ int main(int argc, char** argv)
         {
             double_buffer = true;
         }
+        else if (arg == "--pipeline_depth")
+        {
+            try
+            {
+                pipeline_depth = stoi(argv[++i]);
+                double_buffer = true;
+            }
+            catch (...)
+            {
+                cout << "Invalid Argument\n";
+                failed = true;
+            }
+        }
+        else if (arg == "--streams")
+        {
+            try
+            {
+                streams = stoi(argv[++i]);
+            }
+            catch (...)
+            {
+                cout << "Invalid Argument\n";
+                failed = true;
+            }
+        }
+        else if (arg == "--qps")
+        {
+            try
+            {
+                target_qps = stod(argv[++i]);
+            }
+            catch (...)
+            {
+                cout << "Invalid Argument\n";
+                failed = true;
+            }
+        }
+        else if (arg == "--json")
+        {
+            json_file = argv[++i];
+        }
+        else if (arg == "--csv")
+        {
+            csv_file = argv[++i];
+        }
+        else if (arg == "--compare")
+        {
+            compare_baseline = argv[++i];
+            compare_current = argv[++i];
+        }
+        else if (arg == "--threshold")
+        {
+            try
+            {
+                threshold = stod(argv[++i]);
+            }
+            catch (...)
+            {
+                cout << "Invalid Argument\n";
+                failed = true;
+            }
+        }
+        else if (arg == "--min_us")
+        {
+            try
+            {
+                min_us = stoi(argv[++i]);
+            }
+            catch (...)
+            {
+                cout << "Invalid Argument\n";
+                failed = true;
+            }
+        }
         else if (arg == "-w" || arg == "--warmup_iterations")
         {
             try
@@ -257,7 +361,23 @@ int main(int argc, char** argv)
             failed = true;
         }
     }
-    if (!model_arg.empty() && !file_util::exists(model_arg))
+    if (!compare_baseline.empty())
+    {
+        for (const string& file : {compare_baseline, compare_current})
+        {
+            if (!file_util::exists(file))
+            {
+                cout << "File " << file << " not found\n";
+                failed = true;
+            }
+        }
+        if (threshold < 0 || min_us < 0)
+        {
+            cout << "Threshold and minimum op time must not be negative\n";
+            failed = true;
+        }
+    }
+    else if (!model_arg.empty() && !file_util::exists(model_arg))
     {
         cout << "File " << model_arg << " not found\n";
         failed = true;
@@ -272,6 +392,16 @@ int main(int argc, char** argv)
         cout << "Either file or directory must be specified\n";
         failed = true;
     }
+    else if (pipeline_depth < 1 || streams < 0 || target_qps < 0)
+    {
+        cout << "Pipeline depth must be positive, streams and QPS must not be negative\n";
+        failed = true;
+    }
+    else if (double_buffer && (streams > 0 || target_qps > 0))
+    {
+        cout << "Pipelined and multi-stream modes can't be combined\n";
+        failed = true;
+    }
 
     if (failed)
     {
@@ -281,6 +411,7 @@ DESCRIPTION
 
 SYNOPSIS
         nbench [-f <filename>] [-b <backend>] [-i <iterations>]
+        nbench --compare <baseline.json> <current.json> [--threshold <percent>]
 
 OPTIONS
         -f|--file                 Serialized model file
@@ -294,10 +425,46 @@ OPTIONS
         --no_copy_data            Disable copy of input/result data every iteration
         --dot                     Generate Graphviz dot file
         --double_buffer           Double buffer inputs and outputs
+        --pipeline_depth          Number of buffered inputs and outputs in pipelined mode
+                                  (default: 2, implies --double_buffer)
+        --streams                 Number of concurrent client threads. Reports throughput
+                                  and p50/p95/p99 request latency. Iterations are shared
+                                  by all streams (default: 1 when --qps is given)
+        --qps                     Target requests per second for open loop arrival in
+                                  multi-stream mode (default: 0, closed loop)
+        --json                    Write per-model and per-op results to a JSON file
+        --csv                     Write per-model and per-op results to a CSV file
+        --compare                 Compare two JSON result files and report models and ops
+                                  that regressed. Exits with 2 if there are regressions
+        --threshold               Percent slowdown counted as a regression (default: 5)
+        --min_us                  Ignore ops faster than this many microseconds per call
+                                  in the baseline when comparing (default: 10)
 )###";
         return 1;
     }
 
+    if (!compare_baseline.empty())
+    {
+        try
+        {
+            BenchmarkReport baseline = read_json_report(compare_baseline);
+            BenchmarkReport current = read_json_report(compare_current);
+            // 1 is reserved for errors
+            return compare_reports(baseline, current, threshold, min_us) > 0 ? 2 : 0;
+        }
+        catch (exception& e)
+        {
+            cout << "Failed to compare results\n" << e.what() << endl;
+            return 1;
+        }
+    }
+
+    BenchmarkReport report;
+    init_report(report);
+    report.backend = backend;
+    report.iterations = iterations;
+    report.warmup_iterations = warmup_iterations;
+
     vector<string> models;
     if (!directory.empty())
     {
@@ -318,6 +485,7 @@ OPTIONS
     }
 
     vector<PerfShape> aggregate_perf_data;
+    vector<pair<string, StreamStatistics>> stream_results;
     int rc = 0;
     for (const string& model : models)
     {
@@ -439,16 +607,60 @@ OPTIONS
                 ss << t1.get_milliseconds();
                 cout << "deserialize took " << ss.str() << "ms\n";
                 vector<runtime::PerformanceCounter> perf_data;
+                ModelReport model_report;
+                model_report.model = model;
+                if (!directory.empty() && model.compare(0, directory.size(), directory) == 0)
+                {
+                    // Keep results comparable when the model zoo lives at different paths
+                    model_report.model = model.substr(directory.size());
+                    while (!model_report.model.empty() && model_report.model[0] == '/')
+                    {
+                        model_report.model.erase(0, 1);
+                    }
+                }
                 if (double_buffer)
                 {
-                    perf_data = run_benchmark_pipelined(
-                        f, backend, iterations, timing_detail, warmup_iterations, copy_data);
+                    perf_data = run_benchmark_pipelined(f,
+                                                        backend,
+                                                        iterations,
+                                                        timing_detail,
+                                                        warmup_iterations,
+                                                        copy_data,
+                                                        pipeline_depth,
+                                                        &model_report.iteration_ms);
+                }
+                else if (streams > 0 || target_qps > 0)
+                {
+                    StreamStatistics statistics;
+                    perf_data = run_benchmark_streams(f,
+                                                      backend,
+                                                      iterations,
+                                                      timing_detail,
+                                                      warmup_iterations,
+                                                      copy_data,
+                                                      max(streams, 1),
+                                                      target_qps,
+                                                      statistics);
+                    stream_results.push_back({model_report.model, statistics});
+                    model_report.has_streams = true;
+                    model_report.streams = statistics;
+                    if (statistics.requests > 0)
+                    {
+                        model_report.iteration_ms = statistics.elapsed_ms / statistics.requests;
+                    }
                 }
                 else
                 {
-                    perf_data = run_benchmark(
-                        f, backend, iterations, timing_detail, warmup_iterations, copy_data);
+                    perf_data = run_benchmark(f,
+                                              backend,
+                                              iterations,
+                                              timing_detail,
+                                              warmup_iterations,
+                                              copy_data,
+                                              &model_report.iteration_ms);
                 }
+                model_report.ops = make_op_reports(perf_data);
+                report.models.push_back(model_report);
                 auto perf_shape = to_perf_shape(f, perf_data);
                 aggregate_perf_data.insert(
                     aggregate_perf_data.end(), perf_shape.begin(), perf_shape.end());
@@ -474,6 +686,28 @@ OPTIONS
         cout << "---- Aggregate over all models\n";
         cout << "============================================================================\n";
         print_results(aggregate_perf_data, timing_detail);
+        if (!stream_results.empty())
+        {
+            cout << "\n---- Serving summary ----\n";
+            print_stream_summary(stream_results);
+        }
+    }
+
+    try
+    {
+        if (!json_file.empty())
+        {
+            write_json_report(json_file, report);
+        }
+        if (!csv_file.empty())
+        {
+            write_csv_report(csv_file, report);
+        }
+    }
+    catch (exception& e)
+    {
+        cout << "Failed to write results\n" << e.what() << endl;
+        rc += 1;
     }
 
     return rc;
@@ -65,3 +65,39 @@ NGRAPH_TEST(${BACKEND_NAME}, aliased_output)
     EXPECT_TRUE(test::all_close_f(expectedE, read_vector<float>(out6), MIN_FLOAT_TOLERANCE_BITS));
     EXPECT_TRUE(test::all_close_f(expectedE, read_vector<float>(out7), MIN_FLOAT_TOLERANCE_BITS));
 }
+
+NGRAPH_TEST(${BACKEND_NAME}, aliased_output_through_reshape)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto C = A + B;
+    auto D = make_shared<op::Reshape>(C, AxisVector{0, 1}, Shape{4});
+    auto E = make_shared<op::Reshape>(D, AxisVector{0}, Shape{1, 4});
+    auto F = make_shared<op::Reshape>(A, AxisVector{0, 1}, Shape{4});
+    auto G = make_shared<op::Reshape>(D, AxisVector{0}, Shape{4, 1}) *
+             make_shared<op::Reshape>(F, AxisVector{0}, Shape{4, 1});
+    auto f = make_shared<Function>(NodeVector{E, D, G, F}, ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    shared_ptr<runtime::Tensor> a = backend->create_tensor(element::f32, shape);
+    shared_ptr<runtime::Tensor> b = backend->create_tensor(element::f32, shape);
+    shared_ptr<runtime::Tensor> out1 = backend->create_tensor(element::f32, Shape{1, 4});
+    shared_ptr<runtime::Tensor> out2 = backend->create_tensor(element::f32, Shape{4});
+    shared_ptr<runtime::Tensor> out3 = backend->create_tensor(element::f32, Shape{4, 1});
+    shared_ptr<runtime::Tensor> out4 = backend->create_tensor(element::f32, Shape{4});
+
+    copy_data(a, vector<float>{0, 1, 2, 3});
+    copy_data(b, vector<float>{1, 2, 3, 4});
+    vector<float> expectedC{1, 3, 5, 7};
+    vector<float> expectedG{0, 3, 10, 21};
+    vector<float> expectedA{0, 1, 2, 3};
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({out1, out2, out3, out4}, {a, b});
+    EXPECT_TRUE(test::all_close_f(expectedC, read_vector<float>(out1), MIN_FLOAT_TOLERANCE_BITS));
+    EXPECT_TRUE(test::all_close_f(expectedC, read_vector<float>(out2), MIN_FLOAT_TOLERANCE_BITS));
+    EXPECT_TRUE(test::all_close_f(expectedG, read_vector<float>(out3), MIN_FLOAT_TOLERANCE_BITS));
+    EXPECT_TRUE(test::all_close_f(expectedA, read_vector<float>(out4), MIN_FLOAT_TOLERANCE_BITS));
+}
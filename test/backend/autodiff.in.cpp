@@ -28,6 +28,7 @@
 #include "ngraph/ngraph.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/runtime/reference/avg_pool.hpp"
+#include "util/all_close_f.hpp"
 #include "util/autodiff/backprop_function.hpp"
 #include "util/autodiff/numeric_compare.hpp"
 #include "util/random.hpp"
@@ -1839,6 +1840,52 @@ NGRAPH_TEST(${BACKEND_NAME}, backwards_reverse_sequence_n4d2c3h2w2)
     ASSERT_EQ(read_vector<int>(da), expected);
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, backwards_tanh_chain_checkpointed)
+{
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    Shape shape{2, 3};
+    auto make_backprop = [&](const autodiff::CheckpointPolicy& policy) {
+        auto A = make_shared<op::Parameter>(element::f32, shape);
+        auto B = make_shared<op::Parameter>(element::f32, shape);
+        auto C = make_shared<op::Parameter>(element::f32, shape);
+        shared_ptr<Node> h = A;
+        for (size_t i = 0; i < 9; ++i)
+        {
+            h = make_shared<op::Tanh>(h * B + A);
+        }
+        autodiff::Adjoints adjoints(OutputVector{h}, OutputVector{C}, policy);
+        return make_shared<Function>(
+            OutputVector{adjoints.backprop_output(A), adjoints.backprop_output(B)},
+            ParameterVector{A, B, C});
+    };
+
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    auto c = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{0.1f, -0.2f, 0.3f, -0.4f, 0.5f, -0.6f});
+    copy_data(b, vector<float>{0.9f, 0.8f, -0.7f, 0.6f, -0.5f, 0.4f});
+    copy_data(c, vector<float>{1, 2, 3, 4, 5, 6});
+
+    auto run = [&](const autodiff::CheckpointPolicy& policy) {
+        auto da = backend->create_tensor(element::f32, shape);
+        auto db = backend->create_tensor(element::f32, shape);
+        auto handle = backend->compile(make_backprop(policy));
+        handle->call_with_validate({da, db}, {a, b, c});
+        return make_pair(read_vector<float>(da), read_vector<float>(db));
+    };
+
+    auto expected = run(autodiff::CheckpointPolicy());
+    for (auto policy : {autodiff::CheckpointPolicy::sqrt_n(),
+                        autodiff::CheckpointPolicy::every(2),
+                        autodiff::CheckpointPolicy::memory_budget(64)})
+    {
+        auto result = run(policy);
+        EXPECT_TRUE(test::all_close_f(expected.first, result.first));
+        EXPECT_TRUE(test::all_close_f(expected.second, result.second));
+    }
+}
+
 // clang-format off
 #ifdef AUTODIFF_BACKEND_${BACKEND_NAME}
 #undef AUTODIFF_BACKEND_${BACKEND_NAME}
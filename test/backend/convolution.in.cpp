@@ -20,6 +20,7 @@
 #include "util/all_close_f.hpp"
 #include "util/known_element_types.hpp"
 #include "util/ndarray.hpp"
+#include "util/random.hpp"
 #include "util/test_control.hpp"
 #include "util/test_tools.hpp"
 
@@ -137,6 +138,38 @@ NGRAPH_TEST(${BACKEND_NAME}, convolution_simple_padding)
     EXPECT_TRUE(test::all_close_f(vector<float>{expected_result}, read_vector<float>(result)));
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, convolution_2d_strided_dilated_padded)
+{
+    Shape shape_a{3, 5, 17, 13};
+    Shape shape_b{7, 5, 3, 2};
+    auto make_function = [&]() {
+        auto A = make_shared<op::Parameter>(element::f32, shape_a);
+        auto B = make_shared<op::Parameter>(element::f32, shape_b);
+        auto conv = make_shared<op::Convolution>(A,
+                                                 B,
+                                                 Strides{2, 1},
+                                                 Strides{2, 3},
+                                                 CoordinateDiff{2, -1},
+                                                 CoordinateDiff{1, 3},
+                                                 Strides{1, 2});
+        return make_shared<Function>(conv, ParameterVector{A, B});
+    };
+    auto int_f = make_function();
+    auto backend_f = make_function();
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::Parameter> param : int_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto backend_results = execute(backend_f, args, "${BACKEND_NAME}");
+    EXPECT_TRUE(test::all_close(backend_results.at(0), int_results.at(0), 1.0e-4f, 1.0e-5f));
+}
+
 // The purpose of this test is to check if we can allow
 // data_batch_shape as a node rather than argument
 NGRAPH_TEST(${BACKEND_NAME}, dyn_convolution_backprop_data)
@@ -1436,3 +1436,43 @@ NGRAPH_TEST(${BACKEND_NAME}, avg_pool_bprop_2d_2channel_2image_dyn_shape)
 
 // avg_pool_3d case generation
 NGRAPH_INSTANTIATE_TEST_CASE_P(${BACKEND_NAME}, include_pad, avg_pool_3d_params, testing::Bool());
+
+NGRAPH_TEST(${BACKEND_NAME}, pool_2d_padded_negative_values)
+{
+    // Negative inputs so that padding never wins a max and always lowers an average
+    Shape shape_a{2, 3, 11, 9};
+    Shape window_shape{3, 4};
+    auto move_strides = Strides{2, 1};
+    Shape padding_below{1, 3};
+    Shape padding_above{2, 0};
+    auto make_function = [&]() {
+        auto A = make_shared<op::Parameter>(element::f32, shape_a);
+        auto max_pool =
+            make_shared<op::MaxPool>(A, window_shape, move_strides, padding_below, padding_above);
+        auto avg_pool = make_shared<op::AvgPool>(
+            A, window_shape, move_strides, padding_below, padding_above, false);
+        auto avg_pool_include_pad = make_shared<op::AvgPool>(
+            A, window_shape, move_strides, padding_below, padding_above, true);
+        return make_shared<Function>(NodeVector{max_pool, avg_pool, avg_pool_include_pad},
+                                     ParameterVector{A});
+    };
+    auto int_f = make_function();
+    auto backend_f = make_function();
+
+    test::Uniform<float> rng(-2.0f, -1.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::Parameter> param : int_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto backend_results = execute(backend_f, args, "${BACKEND_NAME}");
+    ASSERT_EQ(backend_results.size(), 3);
+    for (size_t i = 0; i < backend_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close_f(
+            backend_results.at(i), int_results.at(i), DEFAULT_FLOAT_TOLERANCE_BITS + 1));
+    }
+}
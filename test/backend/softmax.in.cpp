@@ -219,6 +219,42 @@ NGRAPH_TEST(${BACKEND_NAME}, softmax_axis_2)
     EXPECT_TRUE(test::all_close(expected, read_vector<float>(result)));
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, softmax_axis_3d_middle)
+{
+    Shape shape{2, 3, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::Softmax>(A, AxisSet{1}), ParameterVector{A});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    // The running maximum grows along the softmax axis in the first column and shrinks in the
+    // second
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 30, 2, 20, 3, 10, -4, 6, -5, 5, -6, 4});
+    auto result = backend->create_tensor(element::f32, shape);
+
+    auto d0 = expf(1) + expf(2) + expf(3);
+    auto d1 = expf(30) + expf(20) + expf(10);
+    auto d2 = expf(-4) + expf(-5) + expf(-6);
+    auto d3 = expf(6) + expf(5) + expf(4);
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {a});
+    vector<float> expected{expf(1) / d0,
+                           expf(30) / d1,
+                           expf(2) / d0,
+                           expf(20) / d1,
+                           expf(3) / d0,
+                           expf(10) / d1,
+                           expf(-4) / d2,
+                           expf(6) / d3,
+                           expf(-5) / d2,
+                           expf(5) / d3,
+                           expf(-6) / d2,
+                           expf(4) / d3};
+    EXPECT_TRUE(test::all_close_f(expected, read_vector<float>(result)));
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, softmax_axis_3d_trivial)
 {
     Shape shape{1, 2, 3};
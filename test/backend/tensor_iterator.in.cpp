@@ -0,0 +1,135 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "util/all_close_f.hpp"
+#include "util/test_control.hpp"
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static string s_manifest = "${MANIFEST}";
+
+NGRAPH_TEST(${BACKEND_NAME}, tensor_iterator_accumulate)
+{
+    auto X = make_shared<op::Parameter>(element::f32, Shape{3, 2});
+    auto H_init = make_shared<op::Parameter>(element::f32, Shape{1, 2});
+    auto W = make_shared<op::Parameter>(element::f32, Shape{1, 2});
+
+    auto Xi = make_shared<op::Parameter>(element::f32, Shape{1, 2});
+    auto Hi = make_shared<op::Parameter>(element::f32, Shape{1, 2});
+    auto W_body = make_shared<op::Parameter>(element::f32, Shape{1, 2});
+    auto Ho = Hi + Xi * W_body;
+    auto body = make_shared<op::TensorIterator::BodyLambda>(OutputVector{Ho},
+                                                            ParameterVector{Xi, Hi, W_body});
+
+    auto tensor_iterator = make_shared<op::TensorIterator>();
+    tensor_iterator->set_body(body);
+    tensor_iterator->set_sliced_input(Xi, X, 0, 1, 1, -1, 0);
+    tensor_iterator->set_merged_input(Hi, H_init, Ho);
+    tensor_iterator->set_invariant_input(W_body, W);
+    auto last = tensor_iterator->get_iter_value(Ho, -1);
+    auto all = tensor_iterator->get_concatenated_slices(Ho, 0, 1, 1, -1, 0);
+
+    auto f = make_shared<Function>(
+        ResultVector{make_shared<op::Result>(last), make_shared<op::Result>(all)},
+        ParameterVector{X, H_init, W});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto x = backend->create_tensor(element::f32, Shape{3, 2});
+    copy_data(x, vector<float>{1, 2, 3, 4, 5, 6});
+    auto h = backend->create_tensor(element::f32, Shape{1, 2});
+    copy_data(h, vector<float>{0, 10});
+    auto w = backend->create_tensor(element::f32, Shape{1, 2});
+    copy_data(w, vector<float>{2, 1});
+    auto result_last = backend->create_tensor(element::f32, Shape{1, 2});
+    auto result_all = backend->create_tensor(element::f32, Shape{3, 2});
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result_last, result_all}, {x, h, w});
+    EXPECT_TRUE(test::all_close_f(vector<float>{18, 22}, read_vector<float>(result_last)));
+    EXPECT_TRUE(test::all_close_f(vector<float>{2, 12, 8, 16, 18, 22},
+                                  read_vector<float>(result_all)));
+
+    // A second call starts again from the initial value
+    handle->call_with_validate({result_last, result_all}, {x, h, w});
+    EXPECT_TRUE(test::all_close_f(vector<float>{18, 22}, read_vector<float>(result_last)));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, tensor_iterator_strided_reverse)
+{
+    auto X = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+
+    auto Xi = make_shared<op::Parameter>(element::f32, Shape{2, 1});
+    auto Yo = Xi + Xi;
+    auto Zo = Xi * Xi;
+    auto body = make_shared<op::TensorIterator::BodyLambda>(OutputVector{Yo, Zo},
+                                                            ParameterVector{Xi});
+
+    // Iterate over the columns of X from last to first
+    auto tensor_iterator = make_shared<op::TensorIterator>();
+    tensor_iterator->set_body(body);
+    tensor_iterator->set_sliced_input(Xi, X, -1, -1, 1, 0, 1);
+    auto all = tensor_iterator->get_concatenated_slices(Yo, 0, 1, 1, -1, 1);
+    auto first = tensor_iterator->get_iter_value(Zo, 0);
+
+    auto f = make_shared<Function>(
+        ResultVector{make_shared<op::Result>(all), make_shared<op::Result>(first)},
+        ParameterVector{X});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto x = backend->create_tensor(element::f32, Shape{2, 3});
+    copy_data(x, vector<float>{1, 2, 3, 4, 5, 6});
+    auto result_all = backend->create_tensor(element::f32, Shape{2, 3});
+    auto result_first = backend->create_tensor(element::f32, Shape{2, 1});
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result_all, result_first}, {x});
+    EXPECT_TRUE(test::all_close_f(vector<float>{6, 4, 2, 12, 10, 8},
+                                  read_vector<float>(result_all)));
+    EXPECT_TRUE(test::all_close_f(vector<float>{9, 36}, read_vector<float>(result_first)));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, tensor_iterator_negative_axis)
+{
+    auto X = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+
+    auto Xi = make_shared<op::Parameter>(element::f32, Shape{2, 1});
+    auto Yo = Xi * Xi;
+    auto body = make_shared<op::TensorIterator::BodyLambda>(OutputVector{Yo},
+                                                            ParameterVector{Xi});
+
+    // Axis -1 is the last axis, the columns of X
+    auto tensor_iterator = make_shared<op::TensorIterator>();
+    tensor_iterator->set_body(body);
+    tensor_iterator->set_sliced_input(Xi, X, 0, 1, 1, -1, -1);
+    auto all = tensor_iterator->get_concatenated_slices(Yo, 0, 1, 1, -1, -1);
+
+    auto f = make_shared<Function>(ResultVector{make_shared<op::Result>(all)},
+                                   ParameterVector{X});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto x = backend->create_tensor(element::f32, Shape{2, 3});
+    copy_data(x, vector<float>{1, 2, 3, 4, 5, 6});
+    auto result_all = backend->create_tensor(element::f32, Shape{2, 3});
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result_all}, {x});
+    EXPECT_TRUE(test::all_close_f(vector<float>{1, 4, 9, 16, 25, 36},
+                                  read_vector<float>(result_all)));
+}
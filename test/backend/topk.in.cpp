@@ -1142,6 +1142,61 @@ NGRAPH_TEST(${BACKEND_NAME}, topk_3d_single_output)
     EXPECT_EQ((vector<int32_t>{2, 0, 1, 2, 1, 0, 0, 1}), read_vector<int32_t>(result0));
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, topk_small_k_with_ties_inner_axis)
+{
+    // k is small relative to the axis, the axis is not innermost and values repeat, so the
+    // lowest index has to win every tie
+    Shape shape{3, 500, 4};
+    Shape rshape{3, 4, 4};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::TopK>(A, 1, element::i64, 4, true, op::TopK::SortType::SORT_VALUES);
+    auto f = make_shared<Function>(OutputVector{B->output(1), B->output(0)}, ParameterVector{A});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    vector<float> data(shape_size(shape));
+    for (size_t i = 0; i < data.size(); i++)
+    {
+        data[i] = static_cast<float>((i * 7919) % 97);
+    }
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, data);
+    auto result_value = backend->create_tensor(element::f32, rshape);
+    auto result_index = backend->create_tensor(element::i64, rshape);
+
+    auto exec = backend->compile(f);
+    exec->call_with_validate({result_value, result_index}, {a});
+    auto actual_value = read_vector<float>(result_value);
+    auto actual_index = read_vector<int64_t>(result_index);
+
+    vector<float> expected_value;
+    vector<int64_t> expected_index;
+    for (size_t i = 0; i < shape[0]; i++)
+    {
+        vector<vector<int64_t>> slices(shape[2]);
+        for (size_t j = 0; j < shape[2]; j++)
+        {
+            slices[j].resize(shape[1]);
+            iota(slices[j].begin(), slices[j].end(), 0);
+            auto value = [&](int64_t index) { return data[(i * shape[1] + index) * shape[2] + j]; };
+            stable_sort(slices[j].begin(), slices[j].end(), [&](int64_t x, int64_t y) {
+                return value(x) > value(y);
+            });
+        }
+        for (size_t r = 0; r < rshape[1]; r++)
+        {
+            for (size_t j = 0; j < shape[2]; j++)
+            {
+                int64_t index = slices[j][r];
+                expected_index.push_back(index);
+                expected_value.push_back(data[(i * shape[1] + index) * shape[2] + j]);
+            }
+        }
+    }
+    EXPECT_EQ(expected_index, actual_index);
+    EXPECT_TRUE(test::all_close_f(expected_value, actual_value, 0));
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, topk_v1_invalid_strings)
 {
     const auto data = make_shared<op::Parameter>(element::f32, Shape{1, 2, 3});
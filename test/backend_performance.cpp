@@ -14,6 +14,7 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -25,8 +26,11 @@
 #include "ngraph/env_util.hpp"
 #include "ngraph/file_util.hpp"
 #include "ngraph/log.hpp"
+#include "ngraph/op/add.hpp"
 #include "ngraph/op/concat.hpp"
+#include "ngraph/op/exp.hpp"
 #include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
 #include "ngraph/serializer.hpp"
 #include "ngraph/util.hpp"
 #include "util/random.hpp"
@@ -141,3 +145,55 @@ TEST(benchmark, concat_32x1x200_axis1_6)
         }
     }
 }
+
+//
+// Times small and large elementwise kernels on the CPU backend with every kernel sent to the
+// Eigen thread pool (threshold 0) and with the size-adaptive threshold. Use it to tune
+// NGRAPH_CPU_PARALLEL_THRESHOLD for a machine.
+//
+TEST(benchmark, cpu_elementwise_parallel_threshold)
+{
+    auto& executor = runtime::cpu::executor::GetCPUExecutor();
+    const size_t default_threshold = executor.get_parallel_threshold();
+    auto backend = runtime::Backend::create("CPU");
+
+    for (size_t count : {16, 256, 4096, 65536, 1048576})
+    {
+        Shape shape{count};
+        auto A = make_shared<op::Parameter>(element::f32, shape);
+        auto B = make_shared<op::Parameter>(element::f32, shape);
+        auto add = make_shared<Function>(make_shared<op::Add>(A, B), ParameterVector{A, B});
+        auto exp = make_shared<Function>(make_shared<op::Exp>(A), ParameterVector{A, B});
+
+        auto a = backend->create_tensor(element::f32, shape);
+        auto b = backend->create_tensor(element::f32, shape);
+        copy_data(a, vector<float>(count, 0.5f));
+        copy_data(b, vector<float>(count, 1.5f));
+        auto result = backend->create_tensor(element::f32, shape);
+
+        const size_t n_runs = std::max<size_t>(10, (size_t(1) << 24) / count);
+        for (auto f : {add, exp})
+        {
+            auto handle = backend->compile(f);
+            std::cout << f->get_results().at(0)->get_argument(0)->description() << " " << count
+                      << ":";
+            for (size_t threshold : {size_t(0), default_threshold})
+            {
+                executor.set_parallel_threshold(threshold);
+                handle->call_with_validate({result}, {a, b});
+
+                stopwatch sw;
+                sw.start();
+                for (size_t i = 0; i < n_runs; i++)
+                {
+                    handle->call({result}, {a, b});
+                }
+                sw.stop();
+                std::cout << " threshold " << threshold << " "
+                          << double(sw.get_nanoseconds()) / n_runs / 1000 << " us/call";
+            }
+            std::cout << std::endl;
+        }
+    }
+    executor.set_parallel_threshold(default_threshold);
+}
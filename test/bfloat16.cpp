@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 #include <climits>
+#include <cstring>
 #include <random>
 
 #include "gtest/gtest.h"
@@ -140,6 +141,38 @@ TEST(bfloat16, to_float)
     EXPECT_EQ(f, 1.03125f);
 }
 
+TEST(bfloat16, bulk_conversions)
+{
+    // Every bit pattern through the bulk path must match the scalar conversion
+    vector<bfloat16> bf(65536);
+    for (size_t i = 0; i < bf.size(); ++i)
+    {
+        bf[i] = bfloat16::from_bits(static_cast<uint16_t>(i));
+    }
+    vector<float> f(bf.size());
+    bfloat16::to_float(bf.data(), f.data(), bf.size());
+    for (size_t i = 0; i < bf.size(); ++i)
+    {
+        float expected = static_cast<float>(bf[i]);
+        EXPECT_EQ(0, memcmp(&expected, &f[i], sizeof(float)));
+    }
+
+    // Odd count so the scalar tail is exercised too
+    mt19937 rng(0);
+    vector<float> values(10007);
+    for (float& value : values)
+    {
+        uint32_t bits = rng();
+        memcpy(&value, &bits, sizeof(value));
+    }
+    vector<bfloat16> out(values.size());
+    bfloat16::from_float(values.data(), out.data(), values.size());
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        EXPECT_EQ(bfloat16(values[i]).to_bits(), out[i].to_bits());
+    }
+}
+
 TEST(bfloat16, numeric_limits)
 {
     bfloat16 infinity = numeric_limits<bfloat16>::infinity();
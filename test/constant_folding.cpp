@@ -19,6 +19,7 @@
 #include "ngraph/ngraph.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "util/all_close_f.hpp"
+#include "util/pass_thread_count.hpp"
 #include "util/test_tools.hpp"
 
 using namespace ngraph;
@@ -521,6 +522,62 @@ TEST(constant_folding, const_convert)
     ASSERT_EQ(values_expected, values_out);
 }
 
+TEST(constant_folding, parallel_kernels)
+{
+    // Large enough for every kernel to be split across the threads
+    Shape shape{512, 384};
+    size_t count = shape_size(shape);
+
+    vector<int32_t> values_a(count);
+    vector<int32_t> values_b(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        values_a[i] = static_cast<int32_t>(i);
+        values_b[i] = static_cast<int32_t>(2 * i);
+    }
+    auto a = op::Constant::create(element::i32, shape, values_a);
+    auto b = op::Constant::create(element::i32, shape, values_b);
+    auto convert = make_shared<op::Convert>(-(a + b), element::f32);
+    auto broadcast_outer = make_shared<op::Broadcast>(convert, Shape{3, 512, 384}, AxisSet{0});
+    auto transpose =
+        make_shared<op::Reshape>(broadcast_outer, AxisVector{0, 2, 1}, Shape{3, 384, 512});
+    auto broadcast_inner = make_shared<op::Broadcast>(convert, Shape{512, 384, 2}, AxisSet{2});
+    auto f = make_shared<Function>(NodeVector{transpose, broadcast_inner}, ParameterVector{});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    {
+        test::PassThreadCount pass_thread_count(4);
+        pass_manager.run_passes(f);
+    }
+
+    ASSERT_EQ(count_ops_of_type<op::Constant>(f), 2);
+
+    auto transposed = as_type_ptr<op::Constant>(f->get_results().at(0)->get_argument(0));
+    ASSERT_TRUE(transposed);
+    auto transposed_values = transposed->get_vector<float>();
+    ASSERT_EQ(transposed_values.size(), 3 * count);
+    for (size_t k = 0; k < 3; k++)
+    {
+        for (size_t j = 0; j < 384; j++)
+        {
+            for (size_t i = 0; i < 512; i++)
+            {
+                ASSERT_EQ(transposed_values[(k * 384 + j) * 512 + i], -3.0f * (i * 384 + j));
+            }
+        }
+    }
+
+    auto broadcasted = as_type_ptr<op::Constant>(f->get_results().at(1)->get_argument(0));
+    ASSERT_TRUE(broadcasted);
+    auto broadcasted_values = broadcasted->get_vector<float>();
+    ASSERT_EQ(broadcasted_values.size(), 2 * count);
+    for (size_t i = 0; i < 2 * count; i++)
+    {
+        ASSERT_EQ(broadcasted_values[i], -3.0f * (i / 2));
+    }
+}
+
 TEST(constant_folding, shape_of)
 {
     Shape input_shape{3, 4, 0, 22, 608, 909, 3};
@@ -14,7 +14,13 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <map>
+#include <sys/stat.h>
+#include <utime.h>
+
 #include "gtest/gtest.h"
+#include "misc.hpp"
+#include "ngraph/file_util.hpp"
 #include "ngraph/ngraph.hpp"
 #include "util/all_close_f.hpp"
 #include "util/ndarray.hpp"
@@ -60,3 +66,95 @@ TEST(cpu_codegen, abc)
                                   (test::NDArray<float, 2>({{50, 72}, {98, 128}})).get_vector(),
                                   MIN_FLOAT_TOLERANCE_BITS));
 }
+
+TEST(cpu_codegen, module_cache)
+{
+    string cache_dir =
+        file_util::path_join(file_util::get_temp_directory_path(), "ngraph_codegen_cache_test");
+    file_util::remove_directory(cache_dir);
+    set_environment("NGRAPH_COMPILER_CACHE_DIR", cache_dir.c_str(), 1);
+
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(A * B + A, ParameterVector{A, B});
+    auto g = make_shared<Function>(A * B - A, ParameterVector{A, B});
+
+    auto compile_and_call = [&](const shared_ptr<Function>& function) {
+        auto backend = runtime::Backend::create("CPU");
+        shared_ptr<runtime::Tensor> a = backend->create_tensor(element::f32, shape);
+        shared_ptr<runtime::Tensor> b = backend->create_tensor(element::f32, shape);
+        shared_ptr<runtime::Tensor> result = backend->create_tensor(element::f32, shape);
+        copy_data(a, vector<float>{1, 2, 3, 4});
+        copy_data(b, vector<float>{5, 6, 7, 8});
+
+        ngraph::pass::PassConfig pass_config;
+        pass_config.set_pass_attribute("CODEGEN", true);
+        auto handle = backend->compile(function, pass_config);
+        handle->call_with_validate({result}, {a, b});
+        return read_vector<float>(result);
+    };
+
+    // Entries are backdated after they are written, so any entry that was rewritten shows a
+    // new modification time
+    const time_t backdated = 1000000000;
+    auto entry_times = [&]() {
+        map<string, time_t> times;
+        file_util::iterate_files(cache_dir, [&](const string& file, bool is_dir) {
+            if (!is_dir)
+            {
+                struct stat st;
+                EXPECT_EQ(0, stat(file.c_str(), &st));
+                times[file] = st.st_mtime;
+            }
+        });
+        return times;
+    };
+    auto backdate_entries = [&]() {
+        for (auto& entry : entry_times())
+        {
+            struct utimbuf times = {backdated, backdated};
+            EXPECT_EQ(0, utime(entry.first.c_str(), &times));
+        }
+    };
+
+    EXPECT_TRUE(test::all_close_f(
+        compile_and_call(f), vector<float>{6, 14, 24, 36}, MIN_FLOAT_TOLERANCE_BITS));
+    // One bitcode and one object file
+    auto first_entries = entry_times();
+    EXPECT_EQ(2, first_entries.size());
+    backdate_entries();
+
+    // A second backend generates the same source, so both entries are read and none is written
+    EXPECT_TRUE(test::all_close_f(
+        compile_and_call(f), vector<float>{6, 14, 24, 36}, MIN_FLOAT_TOLERANCE_BITS));
+    auto hit_entries = entry_times();
+    EXPECT_EQ(2, hit_entries.size());
+    for (auto& entry : hit_entries)
+    {
+        EXPECT_EQ(backdated, entry.second) << entry.first << " was rewritten on a cache hit";
+    }
+
+    // Different source misses and adds its own entries, leaving the existing ones untouched
+    EXPECT_TRUE(test::all_close_f(
+        compile_and_call(g), vector<float>{4, 10, 18, 28}, MIN_FLOAT_TOLERANCE_BITS));
+    auto miss_entries = entry_times();
+    EXPECT_EQ(4, miss_entries.size());
+    size_t new_entries = 0;
+    for (auto& entry : miss_entries)
+    {
+        if (first_entries.count(entry.first) == 0)
+        {
+            EXPECT_NE(backdated, entry.second);
+            new_entries++;
+        }
+        else
+        {
+            EXPECT_EQ(backdated, entry.second);
+        }
+    }
+    EXPECT_EQ(2, new_entries);
+
+    unset_environment("NGRAPH_COMPILER_CACHE_DIR");
+    file_util::remove_directory(cache_dir);
+}
@@ -68,6 +68,7 @@
 #include "ngraph/runtime/cpu/op/convert_layout.hpp"
 #include "ngraph/runtime/cpu/op/deconv.hpp"
 #include "ngraph/runtime/cpu/op/dropout.hpp"
+#include "ngraph/runtime/cpu/op/elementwise_chain.hpp"
 #include "ngraph/runtime/cpu/op/gelu_backprop.hpp"
 #include "ngraph/runtime/cpu/op/group_conv_bias.hpp"
 #include "ngraph/runtime/cpu/op/leaky_relu.hpp"
@@ -77,6 +78,7 @@
 #include "ngraph/runtime/cpu/op/rnn_utils.hpp"
 #include "ngraph/runtime/cpu/op/sigmoid_mul.hpp"
 #include "ngraph/runtime/cpu/op/update_slice.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_elementwise_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_mat_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_post_layout_optimizations.hpp"
@@ -4061,3 +4063,64 @@ TEST(cpu_fusion, mlir_matmul_bias)
 }
 
 #endif
+
+TEST(cpu_fusion, elementwise_chain_pass)
+{
+    Shape shape{8, 16};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, Shape{16});
+    auto x = A + make_shared<op::Broadcast>(B, shape, AxisSet{0});
+    auto exp = make_shared<op::Exp>(x);
+    auto y = make_shared<op::Tanh>(exp) * x - A;
+    // exp is also a result, so it must stay materialized outside the chain
+    auto f = make_shared<Function>(NodeVector{y, exp}, ParameterVector{A, B});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPUElementwiseFusion>();
+    pass_manager.run_passes(f);
+    ASSERT_EQ(count_ops_of_type<op::ElementwiseChain>(f), 1);
+    ASSERT_EQ(count_ops_of_type<op::Exp>(f), 1);
+    ASSERT_EQ(count_ops_of_type<op::Broadcast>(f), 1);
+
+    auto chain = as_type_ptr<op::ElementwiseChain>(
+        f->get_results().at(0)->input_value(0).get_node_shared_ptr());
+    ASSERT_TRUE(chain);
+    EXPECT_EQ(chain->get_program().size(), 3);
+}
+
+TEST(cpu_fusion, MLIR_DISABLE_TEST(elementwise_chain))
+{
+    auto make_function = []() {
+        Shape shape{4, 3, 700};
+        auto X = make_shared<op::Parameter>(element::f32, shape);
+        auto M = make_shared<op::Parameter>(element::f32, Shape{4, 3});
+        auto G = make_shared<op::Parameter>(element::f32, Shape{3});
+        auto E = make_shared<op::Parameter>(element::f32, Shape{});
+        auto d = X - make_shared<op::Broadcast>(M, shape, AxisSet{2});
+        auto g = make_shared<op::Broadcast>(G, shape, AxisSet{0, 2});
+        auto e = make_shared<op::Broadcast>(E, shape, AxisSet{0, 1, 2});
+        auto n = d * g / make_shared<op::Sqrt>(d * d + e);
+        auto y = make_shared<op::Select>(
+            make_shared<op::Greater>(n, d), make_shared<op::Sigmoid>(n), make_shared<op::Relu>(d));
+        return make_shared<Function>(y, ParameterVector{X, M, G, E});
+    };
+    auto int_f = make_function();
+    auto cpu_f = make_function();
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::Parameter> param : int_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    args.back()[0] = 1.0f;
+
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    set_environment("NGRAPH_PASS_ENABLES", "CPUElementwiseFusion:1", 1);
+    auto cpu_results = execute(cpu_f, args, "CPU");
+    unset_environment("NGRAPH_PASS_ENABLES");
+    EXPECT_EQ(count_ops_of_type<op::ElementwiseChain>(cpu_f), 1);
+    EXPECT_TRUE(test::all_close(cpu_results.at(0), int_results.at(0), 1.0e-5f, 1.0e-5f));
+}
@@ -38,9 +38,13 @@
 #include "ngraph/pass/constant_folding.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/visualize_tree.hpp"
+#include "ngraph/runtime/cpu/builder/collapse_dims.hpp"
 #include "ngraph/runtime/cpu/cpu_backend.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/cpu_call_frame.hpp"
+#include "ngraph/runtime/cpu/cpu_executable.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor.hpp"
+#include "ngraph/runtime/cpu/mkldnn_primitive_cache.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
 #include "ngraph/runtime/cpu/op/convert_layout.hpp"
 #include "ngraph/runtime/cpu/op/max_pool_with_indices.hpp"
@@ -687,6 +691,96 @@ TEST(cpu_test, convolution_large_padding)
     compare_backends(int_f, cpu_f, "INTERPRETER", "CPU", 1e-4, 1e-4);
 }
 
+#if MKLDNN_VERSION_MAJOR >= 1
+TEST(cpu_test, convolution_primitive_shared_across_executables)
+{
+    Shape input_shape{2, 3, 17, 13};
+    Shape filter_shape{5, 3, 3, 3};
+
+    auto make_function = [&]() {
+        auto input = std::make_shared<op::Parameter>(element::f32, input_shape);
+        auto filter = std::make_shared<op::Parameter>(element::f32, filter_shape);
+        auto conv = std::make_shared<op::Convolution>(input, filter, Strides{2, 1});
+        return make_shared<Function>(NodeVector{conv}, ParameterVector{input, filter});
+    };
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    for (auto shape : {input_shape, filter_shape})
+    {
+        vector<float> tensor_val(shape_size(shape));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+
+    auto& cache = runtime::cpu::MKLDNNPrimitiveCache::get();
+    auto first_results = execute(make_function(), args, "CPU");
+    size_t cached = cache.size();
+    EXPECT_GT(cached, 0u);
+
+    // A second executable for the same convolution reuses the cached primitive
+    auto second_results = execute(make_function(), args, "CPU");
+    EXPECT_EQ(cache.size(), cached);
+    EXPECT_TRUE(test::all_close_f(first_results.at(0), second_results.at(0)));
+}
+
+TEST(cpu_test, primitive_cache_evicts_unused_primitives)
+{
+    auto make_function = [](const Shape& input_shape) {
+        auto input = std::make_shared<op::Parameter>(element::f32, input_shape);
+        auto filter = std::make_shared<op::Parameter>(element::f32, Shape{4, 3, 3, 3});
+        auto conv = std::make_shared<op::Convolution>(input, filter);
+        return make_shared<Function>(NodeVector{conv}, ParameterVector{input, filter});
+    };
+    auto compile = [](const shared_ptr<runtime::Backend>& backend,
+                      const shared_ptr<Function>& f) {
+        auto handle = backend->compile(f);
+        vector<shared_ptr<runtime::Tensor>> args;
+        for (auto& param : f->get_parameters())
+        {
+            args.push_back(backend->create_tensor(element::f32, param->get_shape()));
+            copy_data(args.back(), vector<float>(shape_size(param->get_shape()), 1.0f));
+        }
+        auto result = backend->create_tensor(element::f32, f->get_output_shape(0));
+        handle->call_with_validate({result}, args);
+        return handle;
+    };
+
+    auto& cache = runtime::cpu::MKLDNNPrimitiveCache::get();
+    cache.set_capacity(0);
+    size_t base = cache.size();
+    {
+        // Primitives in use are never evicted
+        auto backend = runtime::Backend::create("CPU");
+        auto handle = compile(backend, make_function(Shape{1, 3, 11, 9}));
+        EXPECT_GT(cache.size(), base);
+    }
+    EXPECT_EQ(cache.size(), base);
+
+    // Only the most recently released primitive is kept
+    cache.set_capacity(1);
+    {
+        auto backend = runtime::Backend::create("CPU");
+        compile(backend, make_function(Shape{1, 3, 11, 9}));
+    }
+    size_t kept = cache.size();
+    EXPECT_EQ(kept, base + 1);
+    {
+        auto backend = runtime::Backend::create("CPU");
+        compile(backend, make_function(Shape{1, 3, 13, 7}));
+    }
+    EXPECT_EQ(cache.size(), kept);
+    {
+        // The second convolution is served from the cache and releasing it keeps the count
+        auto backend = runtime::Backend::create("CPU");
+        auto handle = compile(backend, make_function(Shape{1, 3, 13, 7}));
+        EXPECT_EQ(cache.size(), kept);
+    }
+    EXPECT_EQ(cache.size(), kept);
+    cache.set_capacity(256);
+}
+#endif
+
 #if 0
 static std::shared_ptr<Function> make_function(const std::string& file_name)
 {
@@ -830,6 +924,165 @@ TEST(cpu_test, memory_reuse_cacheable_no_destructive_oi_relu)
     EXPECT_TRUE(test::all_close_f(read_vector<float>(result), expected));
 }
 
+TEST(cpu_test, warm_up_at_compile)
+{
+    auto shape_a = Shape{2, 5};
+    auto A = make_shared<op::Parameter>(element::f32, shape_a, true);
+    auto B = make_shared<op::Parameter>(element::f32, shape_a, true);
+    auto C = make_shared<op::Parameter>(element::f32, shape_a);
+    auto add = make_shared<op::Add>(A, B);
+    auto relu = make_shared<op::Relu>(add);
+    auto subtract = make_shared<op::Subtract>(C, relu);
+    auto f = make_shared<Function>(subtract, ParameterVector{A, B, C});
+
+    auto backend = runtime::Backend::create("CPU");
+
+    auto a = backend->create_tensor(element::f32, shape_a);
+    copy_data(a, vector<float>{1, 8, -8, 17, -0.5, 1, 8, -8, 17, -0.5});
+    auto b = backend->create_tensor(element::f32, shape_a);
+    copy_data(b, vector<float>{1, 2, 3, 4, 0.5, 1, 8, -8, 17, -0.5});
+    auto c = backend->create_tensor(element::f32, shape_a);
+    copy_data(c, vector<float>{2, 10, 0, 21, 0, 2, 16, 0, 34, 0});
+    auto result = backend->create_tensor(element::f32, shape_a);
+    vector<float> expected{0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+
+    ngraph::pass::PassConfig pass_config;
+    pass_config.set_pass_attribute("CPUWarmUp", true);
+    shared_ptr<runtime::Executable> handle = backend->compile(f, pass_config);
+    ASSERT_NE(handle, nullptr);
+
+    // Cached intermediates from the warm-up run must not be reused for the first real call
+    a->set_stale(false);
+    b->set_stale(false);
+    handle->call_with_validate({result}, {a, b, c});
+    EXPECT_TRUE(test::all_close_f(read_vector<float>(result), expected));
+}
+
+#if MKLDNN_VERSION_MAJOR >= 1
+TEST(cpu_test, warm_up_creates_primitives)
+{
+    Shape input_shape{1, 4, 19, 11};
+    Shape filter_shape{6, 4, 3, 3};
+    auto input = make_shared<op::Parameter>(element::f32, input_shape);
+    auto filter = make_shared<op::Parameter>(element::f32, filter_shape);
+    auto conv = make_shared<op::Convolution>(input, filter, Strides{1, 2});
+    auto f = make_shared<Function>(NodeVector{conv}, ParameterVector{input, filter});
+
+    auto& cache = runtime::cpu::MKLDNNPrimitiveCache::get();
+    size_t cached = cache.size();
+
+    auto backend = runtime::Backend::create("CPU");
+    ngraph::pass::PassConfig pass_config;
+    pass_config.set_pass_attribute("CPUWarmUp", true);
+    auto handle = backend->compile(f, pass_config);
+    ASSERT_NE(handle, nullptr);
+    // The convolution primitive is created by compile, not by the first call
+    size_t warm = cache.size();
+    EXPECT_GT(warm, cached);
+
+    auto a = backend->create_tensor(element::f32, input_shape);
+    auto b = backend->create_tensor(element::f32, filter_shape);
+    auto result = backend->create_tensor(element::f32, conv->get_shape());
+    copy_data(a, vector<float>(shape_size(input_shape), 1.0f));
+    copy_data(b, vector<float>(shape_size(filter_shape), 1.0f));
+    handle->call_with_validate({result}, {a, b});
+    EXPECT_EQ(cache.size(), warm);
+}
+#endif
+
+TEST(cpu_test, warm_up_integer_divide)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::i32, shape);
+    auto B = make_shared<op::Parameter>(element::i32, shape);
+    auto f = make_shared<Function>(make_shared<op::Divide>(A, B), ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("CPU");
+    ngraph::pass::PassConfig pass_config;
+    pass_config.set_pass_attribute("CPUWarmUp", true);
+    // Integer divisors may be zero on synthetic inputs, so warm-up is skipped
+    auto handle = backend->compile(f, pass_config);
+    ASSERT_NE(handle, nullptr);
+
+    auto a = backend->create_tensor(element::i32, shape);
+    copy_data(a, vector<int>{2, 4, 8, 16});
+    auto b = backend->create_tensor(element::i32, shape);
+    copy_data(b, vector<int>{1, 2, 4, 8});
+    auto result = backend->create_tensor(element::i32, shape);
+    handle->call_with_validate({result}, {a, b});
+    EXPECT_EQ((vector<int>{2, 2, 2, 2}), read_vector<int>(result));
+}
+
+TEST(cpu_test, warm_up_gather)
+{
+    Shape params_shape{1, 3};
+    Shape indices_shape{2};
+    auto P = make_shared<op::Parameter>(element::f32, params_shape);
+    auto I = make_shared<op::Parameter>(element::i32, indices_shape);
+    auto f = make_shared<Function>(make_shared<op::Gather>(P, I), ParameterVector{P, I});
+
+    auto backend = runtime::Backend::create("CPU");
+    ngraph::pass::PassConfig pass_config;
+    pass_config.set_pass_attribute("CPUWarmUp", true);
+    // An index of one would be out of bounds, so warm-up is skipped
+    auto handle = backend->compile(f, pass_config);
+    ASSERT_NE(handle, nullptr);
+
+    auto p = backend->create_tensor(element::f32, params_shape);
+    copy_data(p, vector<float>{1, 2, 3});
+    auto i = backend->create_tensor(element::i32, indices_shape);
+    copy_data(i, vector<int>{0, 0});
+    auto result = backend->create_tensor(element::f32, Shape{2, 3});
+    handle->call_with_validate({result}, {p, i});
+    EXPECT_TRUE(test::all_close_f(vector<float>{1, 2, 3, 1, 2, 3}, read_vector<float>(result)));
+}
+
+TEST(cpu_test, incremental_execution)
+{
+    Shape shape{2, 3};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto exp_b = make_shared<op::Exp>(make_shared<op::Negative>(B));
+    auto f = make_shared<Function>(make_shared<op::Add>(A, exp_b), ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("CPU");
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 2, 3, 4, 5, 6});
+    copy_data(b, vector<float>{0, 0, 0, 0, 0, 0});
+
+    auto handle = backend->compile(f);
+    auto cf = dynamic_pointer_cast<runtime::cpu::CPU_Executable>(handle)->get_call_frame();
+    cf->set_incremental_execution(true);
+
+    handle->call_with_validate({result}, {a, b});
+    EXPECT_TRUE(test::all_close_f(vector<float>{2, 3, 4, 5, 6, 7}, read_vector<float>(result)));
+
+    // Only A changes, Negative and Exp over B are reused from the previous call
+    copy_data(a, vector<float>{2, 3, 4, 5, 6, 7});
+    handle->call_with_validate({result}, {a, b});
+    EXPECT_TRUE(test::all_close_f(vector<float>{3, 4, 5, 6, 7, 8}, read_vector<float>(result)));
+
+    auto stats = cf->get_incremental_execution_stats();
+    EXPECT_EQ(stats.calls, 2);
+    EXPECT_EQ(stats.changed_inputs, 3);
+    EXPECT_EQ(stats.unchanged_inputs, 1);
+    EXPECT_GT(stats.skipped_ops, 0);
+
+    // Changing B recomputes its downstream cone
+    cf->reset_incremental_execution_stats();
+    copy_data(b, vector<float>{-1, -1, -1, -1, -1, -1});
+    handle->call_with_validate({result}, {a, b});
+    EXPECT_TRUE(test::all_close_f(
+        vector<float>{2 + expf(1), 3 + expf(1), 4 + expf(1), 5 + expf(1), 6 + expf(1), 7 + expf(1)},
+        read_vector<float>(result)));
+    stats = cf->get_incremental_execution_stats();
+    EXPECT_EQ(stats.changed_inputs, 1);
+    EXPECT_EQ(stats.unchanged_inputs, 1);
+    EXPECT_EQ(stats.skipped_ops, 0);
+}
+
 TEST(cpu_test, memory_reuse_in_place_concat_after_in_place_slice)
 {
     Shape shape_a{4, 4};
@@ -2310,3 +2563,129 @@ TEST(cpu_test, one_hot_scalar_oob_in_3)
     handle->call_with_validate({result}, {a});
     EXPECT_EQ(r_data[3], 0);
 }
+
+TEST(cpu_test, collapse_operated_axes)
+{
+    Shape shape{2, 1, 3, 4, 5};
+    AxisSet axes{3, 4};
+    runtime::cpu::collapse_operated_axes(shape, axes);
+    EXPECT_EQ(shape, (Shape{6, 20}));
+    EXPECT_EQ(axes, (AxisSet{1}));
+
+    shape = Shape{2, 3, 4, 5, 6};
+    axes = AxisSet{0, 2, 3};
+    runtime::cpu::collapse_operated_axes(shape, axes);
+    EXPECT_EQ(shape, (Shape{2, 3, 20, 6}));
+    EXPECT_EQ(axes, (AxisSet{0, 2}));
+
+    shape = Shape{1, 1};
+    axes = AxisSet{0};
+    runtime::cpu::collapse_operated_axes(shape, axes);
+    EXPECT_EQ(shape, (Shape{1}));
+    EXPECT_EQ(axes, (AxisSet{}));
+}
+
+TEST(cpu_test, collapse_transpose)
+{
+    Shape shape{2, 3, 4, 5};
+    AxisVector order{2, 3, 0, 1};
+    runtime::cpu::collapse_transpose(shape, order);
+    EXPECT_EQ(shape, (Shape{6, 20}));
+    EXPECT_EQ(order, (AxisVector{1, 0}));
+
+    shape = Shape{2, 1, 3};
+    order = AxisVector{2, 1, 0};
+    runtime::cpu::collapse_transpose(shape, order);
+    EXPECT_EQ(shape, (Shape{2, 3}));
+    EXPECT_EQ(order, (AxisVector{1, 0}));
+
+    shape = Shape{2, 3, 4};
+    order = AxisVector{0, 1, 2};
+    runtime::cpu::collapse_transpose(shape, order);
+    EXPECT_EQ(shape, (Shape{24}));
+    EXPECT_EQ(order, (AxisVector{0}));
+}
+
+TEST(cpu_test, collapse_slice)
+{
+    Shape arg_shape{4, 5, 6};
+    Shape out_shape{2, 5, 3};
+    Coordinate lower_bounds{1, 0, 0};
+    Coordinate upper_bounds{3, 5, 6};
+    Strides strides{1, 1, 2};
+    runtime::cpu::collapse_slice(arg_shape, out_shape, lower_bounds, upper_bounds, strides);
+    EXPECT_EQ(arg_shape, (Shape{20, 6}));
+    EXPECT_EQ(out_shape, (Shape{10, 3}));
+    EXPECT_EQ(lower_bounds, (Coordinate{5, 0}));
+    EXPECT_EQ(upper_bounds, (Coordinate{15, 6}));
+    EXPECT_EQ(strides, (Strides{1, 2}));
+
+    arg_shape = Shape{4, 5, 6};
+    out_shape = Shape{2, 5, 6};
+    strides = Strides{1, 1, 1};
+    lower_bounds = Coordinate{1, 0, 0};
+    upper_bounds = Coordinate{3, 5, 6};
+    runtime::cpu::collapse_slice(arg_shape, out_shape, lower_bounds, upper_bounds, strides);
+    EXPECT_EQ(arg_shape, (Shape{120}));
+    EXPECT_EQ(out_shape, (Shape{60}));
+    EXPECT_EQ(lower_bounds, (Coordinate{30}));
+    EXPECT_EQ(upper_bounds, (Coordinate{90}));
+    EXPECT_EQ(strides, (Strides{1}));
+}
+
+TEST(cpu_test, collapse_concat)
+{
+    vector<Shape> arg_shapes{Shape{2, 3, 4, 5}, Shape{2, 1, 4, 5}};
+    Shape out_shape{2, 4, 4, 5};
+    size_t axis = 1;
+    runtime::cpu::collapse_concat(arg_shapes, out_shape, axis);
+    EXPECT_EQ(arg_shapes[0], (Shape{2, 3, 20}));
+    EXPECT_EQ(arg_shapes[1], (Shape{2, 1, 20}));
+    EXPECT_EQ(out_shape, (Shape{2, 4, 20}));
+    EXPECT_EQ(axis, 1);
+
+    arg_shapes = vector<Shape>{Shape{1, 2, 3}, Shape{1, 4, 3}};
+    out_shape = Shape{1, 6, 3};
+    axis = 1;
+    runtime::cpu::collapse_concat(arg_shapes, out_shape, axis);
+    EXPECT_EQ(arg_shapes[0], (Shape{2, 3}));
+    EXPECT_EQ(arg_shapes[1], (Shape{4, 3}));
+    EXPECT_EQ(out_shape, (Shape{6, 3}));
+    EXPECT_EQ(axis, 0);
+}
+
+TEST(cpu_test, checkpointed_backprop_keeps_recomputed_ops)
+{
+    Shape shape{2, 3};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto C = make_shared<op::Parameter>(element::f32, shape);
+    shared_ptr<Node> h = A;
+    for (size_t i = 0; i < 8; ++i)
+    {
+        h = make_shared<op::Tanh>(h);
+    }
+    autodiff::Adjoints adjoints(
+        OutputVector{h}, OutputVector{C}, autodiff::CheckpointPolicy::every(4));
+    auto f = make_shared<Function>(OutputVector{adjoints.backprop_output(A)},
+                                   ParameterVector{A, C});
+
+    // The recomputed copies are the only ops with control dependencies
+    auto count_recomputed = [&f]() {
+        size_t count = 0;
+        for (auto& node : f->get_ops())
+        {
+            if (is_type<op::Tanh>(node) && !node->get_control_dependencies().empty())
+            {
+                count++;
+            }
+        }
+        return count;
+    };
+    size_t recomputed = count_recomputed();
+    ASSERT_GT(recomputed, 0);
+
+    auto backend = runtime::Backend::create("CPU");
+    auto handle = backend->compile(f);
+    // CSE must not merge the copies back into the forward ops they recompute
+    EXPECT_EQ(count_recomputed(), recomputed);
+}
@@ -341,3 +341,99 @@ TEST(CSE, pass_property)
     ASSERT_TRUE(pass->get_property(pass::PassProperty::REQUIRE_STATIC_SHAPE));
     ASSERT_FALSE(pass->get_property(pass::PassProperty::CHANGE_DYNAMIC_STATE));
 }
+
+TEST(CSE, generic_attributes)
+{
+    Shape data_shape{1, 2, 8, 8};
+    Shape filters_shape{4, 2, 3, 3};
+    auto A = std::make_shared<op::Parameter>(element::f32, data_shape);
+    auto B = std::make_shared<op::Parameter>(element::f32, filters_shape);
+    // Padding keeps the spatial shape so the convolutions can be concatenated with A
+    auto make_conv = [&](const Strides& strides) {
+        return std::make_shared<op::Convolution>(
+            A, B, strides, Strides{1, 1}, CoordinateDiff{1, 1}, CoordinateDiff{1, 1});
+    };
+    auto conv1 = make_conv(Strides{1, 1});
+    auto conv2 = make_conv(Strides{1, 1});
+    auto conv3 = make_conv(Strides{2, 2});
+    auto concat1 = std::make_shared<op::Concat>(NodeVector{conv1, A}, 1);
+    auto concat2 = std::make_shared<op::Concat>(NodeVector{conv2, A}, 1);
+    auto concat3 = std::make_shared<op::Concat>(NodeVector{conv2, conv2}, 1);
+    auto concat4 = std::make_shared<op::Concat>(NodeVector{conv2, conv2}, 2);
+    auto f = std::make_shared<Function>(NodeVector{conv3, concat1, concat2, concat3, concat4},
+                                        ParameterVector{A, B});
+    pass::Manager pass_manager;
+
+    pass_manager.register_pass<ngraph::pass::CommonSubexpressionElimination>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::Convolution>(f), 2);
+    ASSERT_EQ(count_ops_of_type<op::Concat>(f), 3);
+    ASSERT_EQ(f->get_results().at(1)->get_argument(0), f->get_results().at(2)->get_argument(0));
+    ASSERT_NE(f->get_results().at(3)->get_argument(0), f->get_results().at(4)->get_argument(0));
+}
+
+TEST(CSE, subtract_not_commutative)
+{
+    Shape shape{2, 2};
+    auto A = std::make_shared<op::Parameter>(element::f32, shape);
+    auto B = std::make_shared<op::Parameter>(element::f32, shape);
+    auto sub1 = std::make_shared<op::Subtract>(A, B);
+    auto sub2 = std::make_shared<op::Subtract>(B, A);
+    auto f = std::make_shared<Function>(NodeVector{sub1, sub2}, ParameterVector{A, B});
+    pass::Manager pass_manager;
+
+    pass_manager.register_pass<ngraph::pass::CommonSubexpressionElimination>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::Subtract>(f), 2);
+}
+
+TEST(CSE, duplicate_weights)
+{
+    Shape shape{16, 64};
+    vector<float> weights(shape_size(shape));
+    for (size_t i = 0; i < weights.size(); i++)
+    {
+        weights[i] = static_cast<float>(i % 7) - 3.0f;
+    }
+    vector<float> other_weights(weights);
+    other_weights.back() += 1.0f;
+
+    auto A = std::make_shared<op::Parameter>(element::f32, Shape{4, 16});
+    auto w1 = op::Constant::create(element::f32, shape, weights);
+    auto w2 = op::Constant::create(element::f32, shape, weights);
+    auto w3 = op::Constant::create(element::f32, shape, other_weights);
+    auto z1 = op::Constant::create(element::f32, shape, vector<float>(shape_size(shape), 0.0f));
+    auto z2 = op::Constant::create(element::f32, shape, vector<float>(shape_size(shape), 0.0f));
+    auto f = std::make_shared<Function>(NodeVector{std::make_shared<op::Dot>(A, w1 + z1),
+                                                   std::make_shared<op::Dot>(A, w2 + z2),
+                                                   std::make_shared<op::Dot>(A, w3 + z1)},
+                                        ParameterVector{A});
+    pass::Manager pass_manager;
+
+    pass_manager.register_pass<ngraph::pass::CommonSubexpressionElimination>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::Constant>(f), 3);
+    ASSERT_EQ(count_ops_of_type<op::Add>(f), 2);
+}
+
+TEST(CSE, control_dependencies)
+{
+    Shape shape{2, 2};
+    auto A = std::make_shared<op::Parameter>(element::f32, shape);
+    auto B = std::make_shared<op::Parameter>(element::f32, shape);
+    auto abs1 = std::make_shared<op::Abs>(A);
+    auto neg = std::make_shared<op::Negative>(B);
+    // A recomputed copy that must wait for neg
+    auto abs2 = std::make_shared<op::Abs>(A);
+    abs2->add_control_dependency(neg);
+    auto f = std::make_shared<Function>(NodeVector{abs1 + neg, abs2 + neg}, ParameterVector{A, B});
+    pass::Manager pass_manager;
+
+    pass_manager.register_pass<ngraph::pass::CommonSubexpressionElimination>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::Abs>(f), 2);
+}
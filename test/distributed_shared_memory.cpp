@@ -0,0 +1,192 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <functional>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "ngraph/distributed/shared_memory.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+// Runs body as rank 0 in this process and as ranks 1..size-1 in forked children.
+// Returns true if every rank returned true.
+static bool run_ranks(int size,
+                      size_t slot_bytes,
+                      const function<bool(distributed::SharedMemory&)>& body)
+{
+    static int s_job = 0;
+    string name = "/ngraph_test_" + to_string(getpid()) + "_" + to_string(s_job++);
+
+    auto run_rank = [&](int rank) {
+        try
+        {
+            distributed::SharedMemory dist(name, size, rank, slot_bytes);
+            return body(dist);
+        }
+        catch (...)
+        {
+            return false;
+        }
+    };
+
+    vector<pid_t> children;
+    for (int rank = 1; rank < size; ++rank)
+    {
+        pid_t pid = fork();
+        if (pid == 0)
+        {
+            _exit(run_rank(rank) ? 0 : 1);
+        }
+        children.push_back(pid);
+    }
+    bool ok = run_rank(0);
+    for (pid_t pid : children)
+    {
+        int status = 0;
+        ok = pid > 0 && waitpid(pid, &status, 0) == pid && WIFEXITED(status) &&
+             WEXITSTATUS(status) == 0 && ok;
+    }
+    return ok;
+}
+
+TEST(distributed_shared_memory, all_reduce_sum_chunked)
+{
+    const int size = 3;
+    const size_t count = 100;
+    // 16 floats per chunk, so the reduction runs over several uneven chunks
+    EXPECT_TRUE(run_ranks(size, 64, [&](distributed::SharedMemory& dist) {
+        vector<float> in(count);
+        vector<float> out(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            in[i] = static_cast<float>(dist.get_rank() * 100 + i);
+        }
+        dist.all_reduce(
+            in.data(), out.data(), element::Type_t::f32, reduction::Type::SUM, count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (out[i] != static_cast<float>(size * i + 300))
+            {
+                return false;
+            }
+        }
+        return true;
+    }));
+}
+
+TEST(distributed_shared_memory, all_reduce_in_place)
+{
+    const int size = 4;
+    const size_t count = 37;
+    EXPECT_TRUE(run_ranks(size, 64, [&](distributed::SharedMemory& dist) {
+        vector<int32_t> max_data(count);
+        vector<double> prod_data(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            max_data[i] = static_cast<int32_t>((dist.get_rank() + i) % size);
+            prod_data[i] = dist.get_rank() + 1;
+        }
+        dist.all_reduce(max_data.data(),
+                        max_data.data(),
+                        element::Type_t::i32,
+                        reduction::Type::MAX,
+                        count);
+        dist.all_reduce(prod_data.data(),
+                        prod_data.data(),
+                        element::Type_t::f64,
+                        reduction::Type::PROD,
+                        count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (max_data[i] != size - 1 || prod_data[i] != 24.0)
+            {
+                return false;
+            }
+        }
+        return true;
+    }));
+}
+
+TEST(distributed_shared_memory, broadcast)
+{
+    const int size = 3;
+    const int root_id = 1;
+    const size_t count = 1000;
+    EXPECT_TRUE(run_ranks(size, 256, [&](distributed::SharedMemory& dist) {
+        vector<float> data(count, -1.0f);
+        if (dist.get_rank() == root_id)
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                data[i] = static_cast<float>(i);
+            }
+        }
+        dist.broadcast(data.data(), element::Type_t::f32, count, root_id);
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (data[i] != static_cast<float>(i))
+            {
+                return false;
+            }
+        }
+        return true;
+    }));
+}
+
+TEST(distributed_shared_memory, send_recv_ring)
+{
+    const int size = 4;
+    // Larger than one channel buffer
+    const size_t count = distributed::SharedMemory::s_channel_bytes / sizeof(int64_t) * 3 + 5;
+    EXPECT_TRUE(run_ranks(size, 64, [&](distributed::SharedMemory& dist) {
+        int rank = dist.get_rank();
+        int next = (rank + 1) % size;
+        int prev = (rank + size - 1) % size;
+        vector<int64_t> sent(count);
+        vector<int64_t> received(count, -1);
+        for (size_t i = 0; i < count; ++i)
+        {
+            sent[i] = rank * static_cast<int64_t>(count) + i;
+        }
+        if (rank % 2 == 0)
+        {
+            dist.send(sent.data(), element::Type_t::i64, count, next);
+            dist.recv(received.data(), element::Type_t::i64, count, prev);
+        }
+        else
+        {
+            dist.recv(received.data(), element::Type_t::i64, count, prev);
+            dist.send(sent.data(), element::Type_t::i64, count, next);
+        }
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (received[i] != prev * static_cast<int64_t>(count) + static_cast<int64_t>(i))
+            {
+                return false;
+            }
+        }
+        return true;
+    }));
+}
+
+TEST(distributed_shared_memory, invalid_rank)
+{
+    EXPECT_ANY_THROW(distributed::SharedMemory("/ngraph_test_invalid", 2, 2));
+}
@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 #include <climits>
+#include <cstring>
 #include <random>
 
 #include "gtest/gtest.h"
@@ -110,3 +111,43 @@ TEST(float16, values)
         EXPECT_EQ(intvals.at(i), fp16val.to_bits());
     }
 }
+
+TEST(float16, rounding)
+{
+    // Rounding up must carry into the exponent
+    EXPECT_EQ(float16(2.0f).to_bits(), float16(1.9999f).to_bits());
+    // Values below the smallest denorm go to signed zero
+    EXPECT_EQ(0x0000, float16(1e-10f).to_bits());
+    EXPECT_EQ(0x8000, float16(-1e-10f).to_bits());
+}
+
+TEST(float16, bulk_conversions)
+{
+    // Every bit pattern through the bulk path must match the scalar conversion
+    vector<float16> f16(65536);
+    for (size_t i = 0; i < f16.size(); ++i)
+    {
+        f16[i] = float16::from_bits(static_cast<uint16_t>(i));
+    }
+    vector<float> f(f16.size());
+    float16::to_float(f16.data(), f.data(), f16.size());
+    for (size_t i = 0; i < f16.size(); ++i)
+    {
+        float expected = static_cast<float>(f16[i]);
+        EXPECT_EQ(0, memcmp(&expected, &f[i], sizeof(float)));
+    }
+
+    mt19937 rng(0);
+    vector<float> values(10007);
+    for (float& value : values)
+    {
+        uint32_t bits = rng();
+        memcpy(&value, &bits, sizeof(value));
+    }
+    vector<float16> out(values.size());
+    float16::from_float(values.data(), out.data(), values.size());
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        EXPECT_EQ(float16(values[i]).to_bits(), out[i].to_bits());
+    }
+}
@@ -0,0 +1,178 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ngraph/ngraph.hpp"
+#include "ngraph/pass/int8_calibration.hpp"
+#include "ngraph/pass/manager.hpp"
+#include "util/random.hpp"
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static vector<vector<shared_ptr<runtime::Tensor>>> make_samples(
+    const shared_ptr<runtime::Backend>& backend, const Shape& shape, size_t count, float seed)
+{
+    test::Uniform<float> rng(-1.0f, 1.0f, seed);
+    vector<vector<shared_ptr<runtime::Tensor>>> samples;
+    for (size_t i = 0; i < count; ++i)
+    {
+        samples.push_back({rng.initialize(backend->create_tensor(element::f32, shape))});
+    }
+    return samples;
+}
+
+static vector<float> run(const shared_ptr<runtime::Backend>& backend,
+                         const shared_ptr<Function>& f,
+                         const shared_ptr<runtime::Tensor>& input)
+{
+    auto result =
+        backend->create_tensor(element::f32, f->get_results().at(0)->get_output_shape(0));
+    backend->compile(f)->call_with_validate({result}, {input});
+    return read_vector<float>(result);
+}
+
+// Returns the largest error of the calibrated function relative to the largest output
+static float calibrate_and_compare(const shared_ptr<Function>& f,
+                                   const Shape& input_shape,
+                                   pass::Int8Calibration::Method method)
+{
+    auto backend = runtime::Backend::create("INTERPRETER");
+    auto input = make_samples(backend, input_shape, 1, 100)[0][0];
+    auto expected = run(backend, clone_function(*f), input);
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::Int8Calibration>(
+        backend, make_samples(backend, input_shape, 8, 0), method);
+    pass_manager.run_passes(f);
+
+    auto actual = run(backend, f, input);
+    float max_error = 0;
+    float max_value = 0;
+    for (size_t i = 0; i < expected.size(); ++i)
+    {
+        max_error = max(max_error, fabs(expected[i] - actual[i]));
+        max_value = max(max_value, fabs(expected[i]));
+    }
+    return max_error / max_value;
+}
+
+TEST(int8_calibration, convolution)
+{
+    Shape input_shape{1, 2, 6, 6};
+    auto A = make_shared<op::Parameter>(element::f32, input_shape);
+    vector<float> weights(3 * 2 * 3 * 3);
+    test::Uniform<float>(-0.5f, 0.5f, 1).initialize(weights);
+    auto W = op::Constant::create(element::f32, Shape{3, 2, 3, 3}, weights);
+    auto conv = make_shared<op::Convolution>(make_shared<op::Relu>(A), W);
+    auto f = make_shared<Function>(conv, ParameterVector{A});
+
+    EXPECT_LT(calibrate_and_compare(f, input_shape, pass::Int8Calibration::Method::MIN_MAX),
+              0.03f);
+    EXPECT_EQ(count_ops_of_type<op::Convolution>(f), 0);
+    EXPECT_EQ(count_ops_of_type<op::QuantizedConvolution>(f), 1);
+    EXPECT_EQ(count_ops_of_type<op::Quantize>(f), 1);
+    EXPECT_EQ(count_ops_of_type<op::Dequantize>(f), 1);
+}
+
+TEST(int8_calibration, dot_chain)
+{
+    Shape input_shape{4, 16};
+    auto A = make_shared<op::Parameter>(element::f32, input_shape);
+    vector<float> w1(16 * 8);
+    vector<float> w2(8 * 4);
+    test::Uniform<float>(-0.5f, 0.5f, 2).initialize(w1);
+    test::Uniform<float>(-0.5f, 0.5f, 3).initialize(w2);
+    auto dot1 = make_shared<op::Dot>(make_shared<op::Relu>(A),
+                                     op::Constant::create(element::f32, Shape{16, 8}, w1));
+    auto dot2 = make_shared<op::Dot>(make_shared<op::Relu>(dot1),
+                                     op::Constant::create(element::f32, Shape{8, 4}, w2));
+    auto f = make_shared<Function>(dot2, ParameterVector{A});
+
+    EXPECT_LT(calibrate_and_compare(f, input_shape, pass::Int8Calibration::Method::PERCENTILE),
+              0.05f);
+    EXPECT_EQ(count_ops_of_type<op::Dot>(f), 0);
+    EXPECT_EQ(count_ops_of_type<op::QuantizedDot>(f), 2);
+}
+
+TEST(int8_calibration, dot_direct_chain)
+{
+    // dot2 consumes dot1 directly, so its input is a Dequantize by the time it is rewritten.
+    // Positive weights keep dot1's output unsigned so both Dots are quantized.
+    Shape input_shape{4, 16};
+    auto A = make_shared<op::Parameter>(element::f32, input_shape);
+    vector<float> w1(16 * 8);
+    vector<float> w2(8 * 4);
+    test::Uniform<float>(0.0f, 0.5f, 4).initialize(w1);
+    test::Uniform<float>(-0.5f, 0.5f, 5).initialize(w2);
+    auto dot1 = make_shared<op::Dot>(make_shared<op::Relu>(A),
+                                     op::Constant::create(element::f32, Shape{16, 8}, w1));
+    auto dot2 = make_shared<op::Dot>(dot1, op::Constant::create(element::f32, Shape{8, 4}, w2));
+    auto f = make_shared<Function>(dot2, ParameterVector{A});
+
+    EXPECT_LT(calibrate_and_compare(f, input_shape, pass::Int8Calibration::Method::MIN_MAX),
+              0.05f);
+    EXPECT_EQ(count_ops_of_type<op::Dot>(f), 0);
+    EXPECT_EQ(count_ops_of_type<op::QuantizedDot>(f), 2);
+}
+
+TEST(int8_calibration, signed_input_stays_f32)
+{
+    // The quantized kernels take u8 data, so a Dot on signed input is left alone
+    Shape input_shape{2, 4};
+    auto A = make_shared<op::Parameter>(element::f32, input_shape);
+    auto W = op::Constant::create(element::f32, Shape{4, 2}, {1, 2, 3, 4, 5, 6, 7, 8});
+    auto f = make_shared<Function>(make_shared<op::Dot>(A, W), ParameterVector{A});
+
+    auto backend = runtime::Backend::create("INTERPRETER");
+    pass::Int8Calibration calibration(backend, make_samples(backend, input_shape, 2, 0));
+    EXPECT_FALSE(calibration.run_on_function(f));
+    EXPECT_EQ(count_ops_of_type<op::Dot>(f), 1);
+    EXPECT_LT(calibration.get_ranges().at(A->output(0)).min, 0.0f);
+}
+
+TEST(int8_calibration, percentile_clips_outliers)
+{
+    Shape input_shape{1, 1000};
+    auto A = make_shared<op::Parameter>(element::f32, input_shape);
+    auto R = make_shared<op::Relu>(A);
+    auto W = op::Constant::create(element::f32, Shape{1000, 1}, vector<float>(1000, 0.001f));
+    auto f = make_shared<Function>(make_shared<op::Dot>(R, W), ParameterVector{A});
+
+    auto backend = runtime::Backend::create("INTERPRETER");
+    auto samples = make_samples(backend, input_shape, 1, 0);
+    vector<float> values = read_vector<float>(samples[0][0]);
+    values[0] = 100.0f;
+    copy_data(samples[0][0], values);
+
+    NodeMap node_map;
+    auto g = clone_function(*f, node_map);
+    pass::Int8Calibration min_max(backend, samples, pass::Int8Calibration::Method::MIN_MAX);
+    min_max.run_on_function(f);
+    pass::Int8Calibration percentile(
+        backend, samples, pass::Int8Calibration::Method::PERCENTILE, 99.0f);
+    percentile.run_on_function(g);
+
+    EXPECT_EQ(min_max.get_ranges().at(R->output(0)).max, 100.0f);
+    EXPECT_LT(percentile.get_ranges().at(node_map.at(R.get())->output(0)).max, 2.0f);
+}
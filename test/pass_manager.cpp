@@ -15,15 +15,20 @@
 //*****************************************************************************
 
 #include <memory>
+#include <mutex>
+#include <set>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "gtest/gtest.h"
 
 #include "ngraph/graph_util.hpp"
 #include "ngraph/ngraph.hpp"
+#include "ngraph/pass/assign_layout.hpp"
 #include "ngraph/pass/manager.hpp"
+#include "util/pass_thread_count.hpp"
 #include "util/test_tools.hpp"
 
 using namespace ngraph;
@@ -67,3 +72,124 @@ TEST(pass_manager, serialize_with_revalidate_does_not_crash)
     auto graph = make_test_graph();
     pass_manager.run_passes(graph);
 }
+
+namespace
+{
+    class ReplaceNegativePass : public pass::FunctionPass
+    {
+    public:
+        bool run_on_function(std::shared_ptr<ngraph::Function> f) override
+        {
+            for (auto node : f->get_ordered_ops())
+            {
+                if (is_type<op::Negative>(node))
+                {
+                    replace_node(node, make_shared<op::Abs>(node->get_argument(0)));
+                    return true;
+                }
+            }
+            return false;
+        }
+    };
+}
+
+TEST(pass_manager, profile)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto B = make_shared<op::Negative>(A);
+    auto C = make_shared<op::Exp>(B);
+    auto f = make_shared<Function>(C, ParameterVector{A});
+
+    pass::Manager pass_manager;
+    pass_manager.set_profiling(true);
+    pass_manager.register_pass<ReplaceNegativePass>();
+    pass_manager.run_passes(f);
+
+    auto& profiles = pass_manager.get_profile().get_pass_profiles();
+    ASSERT_EQ(profiles.size(), 2);
+    EXPECT_NE(profiles[0].name.find("ReplaceNegativePass"), string::npos);
+    EXPECT_EQ(profiles[0].nodes_before, 4);
+    EXPECT_EQ(profiles[0].nodes_after, 4);
+    EXPECT_EQ(profiles[0].rewrites, 1);
+    EXPECT_LE(profiles[0].validate_microseconds, profiles[0].microseconds);
+    EXPECT_NE(profiles[1].name.find("Validate"), string::npos);
+    EXPECT_EQ(profiles[1].rewrites, 0);
+    EXPECT_LE(profiles[1].start_microseconds + profiles[1].microseconds,
+              pass_manager.get_profile().get_total_microseconds());
+
+    stringstream json;
+    pass_manager.get_profile().write_json(json);
+    EXPECT_NE(json.str().find(R"("rewrites":1)"), string::npos);
+
+    stringstream trace;
+    pass_manager.get_profile().write_chrome_trace(trace);
+    EXPECT_NE(trace.str().find(R"("traceEvents")"), string::npos);
+    EXPECT_NE(trace.str().find(R"("ph":"X")"), string::npos);
+}
+
+namespace
+{
+    class ThreadRecordingAssignLayout
+        : public pass::AssignLayout<descriptor::layout::DenseTensorLayout>
+    {
+    public:
+        bool run_on_node(std::shared_ptr<ngraph::Node> node) override
+        {
+            {
+                lock_guard<mutex> lock(m_mutex);
+                m_threads.insert(this_thread::get_id());
+            }
+            return AssignLayout::run_on_node(node);
+        }
+
+        mutex m_mutex;
+        set<thread::id> m_threads;
+    };
+
+    shared_ptr<Function> make_layout_test_function()
+    {
+        auto A = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+        shared_ptr<Node> x = A;
+        for (size_t i = 0; i < 2000; i++)
+        {
+            auto wide = make_shared<op::Broadcast>(x, Shape{2, 3, i % 5 + 1}, AxisSet{2});
+            x = make_shared<op::Negative>(make_shared<op::Sum>(wide, AxisSet{2}));
+        }
+        return make_shared<Function>(x, ParameterVector{A});
+    }
+
+    vector<Strides> get_layout_strides(const shared_ptr<Function>& f)
+    {
+        vector<Strides> strides;
+        for (auto& node : f->get_ordered_ops())
+        {
+            for (size_t i = 0; i < node->get_output_size(); i++)
+            {
+                auto layout = node->output(i).get_tensor().get_tensor_layout();
+                EXPECT_TRUE(layout) << *node;
+                strides.push_back(layout ? layout->get_strides() : Strides{});
+            }
+        }
+        return strides;
+    }
+}
+
+TEST(pass_manager, node_local_pass_parallel)
+{
+    auto serial_f = make_layout_test_function();
+    {
+        test::PassThreadCount thread_count(1);
+        pass::Manager pass_manager;
+        pass_manager.register_pass<pass::AssignLayout<descriptor::layout::DenseTensorLayout>>();
+        pass_manager.run_passes(serial_f);
+    }
+
+    auto parallel_f = make_layout_test_function();
+    test::PassThreadCount thread_count(4);
+    pass::Manager pass_manager;
+    auto assign_layout = pass_manager.register_pass<ThreadRecordingAssignLayout>();
+    pass_manager.run_passes(parallel_f);
+
+    EXPECT_GT(assign_layout->m_threads.size(), 1);
+    EXPECT_EQ(get_layout_strides(serial_f), get_layout_strides(parallel_f));
+}
@@ -21,12 +21,14 @@
 
 #include "gtest/gtest.h"
 
+#include "ngraph/autodiff/adjoints.hpp"
 #include "ngraph/ngraph.hpp"
 #include "ngraph/pass/dump_sorted.hpp"
 #include "ngraph/pass/liveness.hpp"
 #include "ngraph/pass/liveness.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/memory_layout.hpp"
+#include "ngraph/pass/memory_optimization.hpp"
 #include "ngraph/pass/visualize_tree.hpp"
 #include "util/test_tools.hpp"
 
@@ -232,3 +234,146 @@ TEST(memory_layout, constant)
     size_t temporary_pool_size = f->get_temporary_pool_size();
     EXPECT_EQ(4, temporary_pool_size);
 }
+
+TEST(memory_layout, in_place_elementwise)
+{
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::MemoryOptimization>();
+    pass_manager.register_pass<pass::Liveness>();
+    pass_manager.register_pass<pass::MemoryLayout>(1, false, true);
+
+    Shape shape{4};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Abs>(A);
+    auto C = make_shared<op::Negative>(B);
+    auto D = make_shared<op::Exp>(C);
+    auto f = make_shared<Function>(D, ParameterVector{A});
+
+    pass_manager.run_passes(f);
+    EXPECT_EQ(16, f->get_temporary_pool_size());
+    EXPECT_EQ(B->get_output_tensor(0).get_pool_offset(), D->get_output_tensor(0).get_pool_offset());
+}
+
+TEST(memory_layout, in_place_elementwise_live_input)
+{
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::MemoryOptimization>();
+    pass_manager.register_pass<pass::Liveness>();
+    pass_manager.register_pass<pass::MemoryLayout>(1, false, true);
+
+    Shape shape{4};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Abs>(A);
+    auto C = make_shared<op::Negative>(B);
+    auto D = make_shared<op::Add>(B, C);
+    auto f = make_shared<Function>(D, ParameterVector{A});
+
+    pass_manager.run_passes(f);
+    // B is still needed by D, so C cannot overwrite it
+    EXPECT_NE(B->get_output_tensor(0).get_pool_offset(), C->get_output_tensor(0).get_pool_offset());
+    EXPECT_EQ(32, f->get_temporary_pool_size());
+}
+
+TEST(memory_layout, in_place_reshape_and_slice)
+{
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::MemoryOptimization>();
+    pass_manager.register_pass<pass::Liveness>();
+    pass_manager.register_pass<pass::MemoryLayout>(1, false, true);
+
+    Shape shape{4, 4};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Abs>(A);
+    auto C = make_shared<op::Reshape>(B, AxisVector{0, 1}, Shape{16});
+    auto D = make_shared<op::Slice>(B, Coordinate{2, 0}, Coordinate{4, 4});
+    auto f = make_shared<Function>(NodeVector{C, D}, ParameterVector{A});
+
+    pass_manager.run_passes(f);
+    size_t offset = B->get_output_tensor(0).get_pool_offset();
+    EXPECT_EQ(offset, C->get_output_tensor(0).get_pool_offset());
+    EXPECT_EQ(offset + 32, D->get_output_tensor(0).get_pool_offset());
+    EXPECT_EQ(64, f->get_temporary_pool_size());
+}
+
+TEST(memory_layout, in_place_concat)
+{
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::MemoryOptimization>();
+    pass_manager.register_pass<pass::Liveness>();
+    pass_manager.register_pass<pass::MemoryLayout>(1, false, true);
+
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Abs>(A);
+    auto C = make_shared<op::Negative>(A);
+    auto D = make_shared<op::Concat>(NodeVector{B, C}, 0);
+    auto f = make_shared<Function>(D, ParameterVector{A});
+
+    pass_manager.run_passes(f);
+    size_t offset = D->get_output_tensor(0).get_pool_offset();
+    EXPECT_EQ(offset, B->get_output_tensor(0).get_pool_offset());
+    EXPECT_EQ(offset + 16, C->get_output_tensor(0).get_pool_offset());
+    EXPECT_EQ(32, f->get_temporary_pool_size());
+}
+
+static size_t get_backprop_pool_size(const autodiff::CheckpointPolicy& policy)
+{
+    Shape shape{256};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto C = make_shared<op::Parameter>(element::f32, shape);
+    shared_ptr<Node> h = A;
+    for (size_t i = 0; i < 16; ++i)
+    {
+        h = make_shared<op::Tanh>(h);
+    }
+    autodiff::Adjoints adjoints(OutputVector{h}, OutputVector{C}, policy);
+    auto f = make_shared<Function>(OutputVector{adjoints.backprop_output(A)},
+                                   ParameterVector{A, C});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::Liveness>();
+    pass_manager.register_pass<pass::MemoryLayout>();
+    pass_manager.run_passes(f);
+    return f->get_temporary_pool_size();
+}
+
+TEST(memory_layout, checkpointed_backprop)
+{
+    size_t stored = get_backprop_pool_size(autodiff::CheckpointPolicy());
+    size_t sqrt_n = get_backprop_pool_size(autodiff::CheckpointPolicy::sqrt_n());
+    size_t every_8 = get_backprop_pool_size(autodiff::CheckpointPolicy::every(8));
+    size_t budget = get_backprop_pool_size(autodiff::CheckpointPolicy::memory_budget(4096));
+    // Every one of the 16 activations is live at the start of backprop
+    EXPECT_GE(stored, 16 * 1024);
+    EXPECT_LT(sqrt_n, stored / 2);
+    EXPECT_LT(every_8, stored);
+    EXPECT_LT(budget, stored / 2);
+}
+
+TEST(memory_layout, in_place_views_opt_in)
+{
+    // Annotations as set by a backend layout pass (e.g. the GPU backend's GPULayout). Its kernels
+    // copy the input to the output, so a live input must not be aliased unless asked for.
+    auto shares_live_input = [](bool plan_in_place_views) {
+        Shape shape{4, 4};
+        auto A = make_shared<op::Parameter>(element::f32, shape);
+        auto B = make_shared<op::Abs>(A);
+        auto C = make_shared<op::Reshape>(B, AxisVector{0, 1}, shape);
+        auto D = make_shared<op::Add>(B, C);
+        auto f = make_shared<Function>(D, ParameterVector{A});
+
+        auto pass_through = make_shared<op::util::OpAnnotations>();
+        pass_through->add_in_place_oi_pair({0, 0, false});
+        C->set_op_annotations(pass_through);
+
+        pass::Manager pass_manager;
+        pass_manager.register_pass<pass::Liveness>();
+        pass_manager.register_pass<pass::MemoryLayout>(1, false, plan_in_place_views);
+        pass_manager.run_passes(f);
+        return B->get_output_tensor(0).get_pool_offset() ==
+               C->get_output_tensor(0).get_pool_offset();
+    };
+
+    EXPECT_FALSE(shares_live_input(false));
+    EXPECT_TRUE(shares_live_input(true));
+}
@@ -362,3 +362,50 @@ TEST(specialize_function, share_constants_with_cf)
     ASSERT_EQ(add_const_1->output(0).get_target_inputs().size(), 1);
     ASSERT_EQ(add_const_2->output(0).get_target_inputs().size(), 1);
 }
+
+// Test checks that specialized constants reuse the data buffer of the original constants
+TEST(specialize_function, constant_data_shared)
+{
+    auto p0 = std::make_shared<op::Parameter>(element::f32, PartialShape::dynamic());
+    auto k = op::Constant::create(element::f32, Shape{4}, {1, 2, 3, 4});
+    auto add = std::make_shared<op::Add>(p0, k);
+
+    auto f = std::make_shared<Function>(add, ParameterVector{p0});
+
+    auto g = specialize_function(f, {element::f32}, {PartialShape{4}}, {nullptr});
+
+    auto k_specialized = as_type_ptr<op::Constant>(
+        g->get_results().at(0)->get_input_node_shared_ptr(0)->get_input_node_shared_ptr(1));
+    ASSERT_NE(k_specialized, nullptr);
+    ASSERT_NE(k_specialized, k);
+    ASSERT_EQ(k_specialized->get_data_ptr(), k->get_data_ptr());
+    ASSERT_EQ(g->get_output_shape(0), (Shape{4}));
+}
+
+TEST(specialize_function, DISABLED_benchmark_large_graph)
+{
+    const size_t steps = 25000;
+    auto x = std::make_shared<op::Parameter>(element::f32, PartialShape{Dimension::dynamic(), 16});
+    std::shared_ptr<Node> h = x;
+    for (size_t i = 0; i < steps; i++)
+    {
+        auto w = op::Constant::create(element::f32, Shape{16, 16}, std::vector<float>(256, 0.5f));
+        h = std::make_shared<op::Tanh>(std::make_shared<op::Dot>(h, w) + h);
+    }
+    auto f = std::make_shared<Function>(h, ParameterVector{x});
+    size_t node_count = f->get_ops().size();
+
+    stopwatch sw;
+    sw.start();
+    auto clone = clone_function(*f);
+    sw.stop();
+    std::cout << "Cloned " << node_count << " nodes in " << sw.get_milliseconds() << " ms"
+              << std::endl;
+
+    sw.start();
+    auto g = specialize_function(f, {element::f32}, {PartialShape{8, 16}}, {nullptr});
+    sw.stop();
+    std::cout << "Specialized " << node_count << " nodes in " << sw.get_milliseconds() << " ms"
+              << std::endl;
+    EXPECT_EQ(g->get_output_shape(0), (Shape{8, 16}));
+}
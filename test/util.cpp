@@ -14,6 +14,7 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
 #include <fstream>
 #include <sstream>
 #include <string>
@@ -29,9 +30,11 @@
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/visualize_tree.hpp"
 #include "ngraph/serializer.hpp"
+#include "ngraph/stable_vector.hpp"
 #include "util/all_close.hpp"
 #include "util/autodiff/backprop_function.hpp"
 #include "util/ndarray.hpp"
+#include "util/pass_thread_count.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -560,6 +563,77 @@ TEST(graph, huge)
     }
 }
 
+TEST(util, stable_vector)
+{
+    StableVector<string, 2> v;
+    EXPECT_TRUE(v.empty());
+    vector<string*> addresses;
+    for (size_t i = 0; i < 100; i++)
+    {
+        addresses.push_back(&v.emplace_back(to_string(i)));
+    }
+    ASSERT_EQ(v.size(), 100);
+    for (size_t i = 0; i < v.size(); i++)
+    {
+        EXPECT_EQ(&v[i], addresses[i]);
+        EXPECT_EQ(v.at(i), to_string(i));
+    }
+    size_t i = 0;
+    for (auto& value : v)
+    {
+        EXPECT_EQ(value, to_string(i++));
+    }
+    EXPECT_EQ(i, 100);
+    EXPECT_EQ(v.end() - v.begin(), 100);
+    EXPECT_EQ(v.back(), "99");
+    EXPECT_THROW(v.at(100), std::out_of_range);
+    v.clear();
+    EXPECT_TRUE(v.empty());
+}
+
+// Builds an unrolled recurrence that reuses one weight in every step and reports construction,
+// traversal and clone times and the memory used per node.
+TEST(graph, DISABLED_benchmark_large_graph)
+{
+    const size_t steps = 100000;
+    auto resident_bytes = []() -> size_t {
+        size_t pages = 0;
+        size_t resident = 0;
+        ifstream statm("/proc/self/statm");
+        statm >> pages >> resident;
+        return resident * 4096;
+    };
+
+    size_t memory_before = resident_bytes();
+    stopwatch sw;
+    sw.start();
+    auto x = make_shared<op::Parameter>(element::f32, Shape{4, 16});
+    auto w = make_shared<op::Parameter>(element::f32, Shape{16, 16});
+    shared_ptr<Node> h = x;
+    for (size_t i = 0; i < steps; i++)
+    {
+        h = make_shared<op::Tanh>(make_shared<op::Dot>(h, w) + x);
+    }
+    auto f = make_shared<Function>(h, ParameterVector{x, w});
+    sw.stop();
+    size_t node_count = f->get_ops().size();
+    size_t memory_after = resident_bytes();
+    cout << "Built " << node_count << " nodes in " << sw.get_milliseconds() << " ms, "
+         << (memory_after - memory_before) / node_count << " bytes/node" << endl;
+
+    sw.start();
+    size_t visited = 0;
+    traverse_nodes(f, [&visited](shared_ptr<Node>) { visited++; });
+    sw.stop();
+    EXPECT_EQ(visited, node_count);
+    cout << "Traversed in " << sw.get_milliseconds() << " ms" << endl;
+
+    sw.start();
+    auto clone = clone_function(*f);
+    sw.stop();
+    cout << "Cloned in " << sw.get_milliseconds() << " ms" << endl;
+}
+
 TEST(util, apply_permutation)
 {
     ASSERT_EQ(apply_permutation(Shape{0, 1, 2, 3}, AxisVector{2, 1, 0, 3}), (Shape{2, 1, 0, 3}));
@@ -712,3 +786,28 @@ TEST(util, topological_sort_replace)
 
     EXPECT_TRUE(custom_sorter_used);
 }
+
+TEST(util, parallel_for)
+{
+    test::PassThreadCount pass_thread_count(4);
+
+    vector<int> visits(10000, 0);
+    parallel_for(0, visits.size(), 100, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++)
+        {
+            visits[i]++;
+        }
+    });
+    EXPECT_TRUE(all_of(visits.begin(), visits.end(), [](int v) { return v == 1; }));
+
+    EXPECT_THROW(parallel_for(0,
+                              visits.size(),
+                              100,
+                              [](size_t begin, size_t) {
+                                  if (begin > 0)
+                                  {
+                                      throw ngraph_error("range failed");
+                                  }
+                              }),
+                 ngraph_error);
+}
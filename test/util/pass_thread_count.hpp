@@ -0,0 +1,44 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+
+#include "ngraph/parallel.hpp"
+
+namespace ngraph
+{
+    namespace test
+    {
+        /// \brief Set the compile-time thread count for the duration of a unit test.
+        ///
+        /// During creation this object sets the thread count used by parallel_for, when it's
+        /// destroyed it restores the previous count, even if the test fails.
+        class PassThreadCount
+        {
+        public:
+            PassThreadCount(size_t thread_count)
+            {
+                saved_thread_count = get_pass_thread_count();
+                set_pass_thread_count(thread_count);
+            }
+            ~PassThreadCount() { set_pass_thread_count(saved_thread_count); }
+        private:
+            size_t saved_thread_count;
+        };
+    }
+}